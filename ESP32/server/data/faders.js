@@ -50,18 +50,13 @@ function addChannel(channelNumber, container = document.getElementById('channels
      
     container.insertBefore(channelDiv, document.getElementById('main-channels-container'));
 
-    // Event Listener with debouncer//
+    // Event Listener, every move is sent (the mixer smooths gain changes itself)
     const rangeInput = document.getElementById(`range-input${channelNumber}`);
 
-
-    let debounceTimer;
     rangeInput.addEventListener('input', () => {
-        clearTimeout(debounceTimer);  // Reset timer on each input event
-        debounceTimer = setTimeout(() => {
-            ws_sendChannelVolume(channelNumber, rangeInput.value);
-            // console.log(`Channel ${channelNumber} value: ${rangeInput.value}`);
-        }, 70);  // Adjust delay (in milliseconds) as needed
-});
+        ws_sendChannelVolume(channelNumber, rangeInput.value);
+        // console.log(`Channel ${channelNumber} value: ${rangeInput.value}`);
+    });
 }
 
 // Function to create and append a new main channel
@@ -92,21 +87,9 @@ function addMainChannel(name, container) {
     const rangeInput = document.getElementById(`range-input-${name}`);
 
 
-    let debounceTimer;
     rangeInput.addEventListener('input', () => {
-        clearTimeout(debounceTimer);  // Reset timer on each input event
-        debounceTimer = setTimeout(() => {
-            ws_sendChannelVolume(9, rangeInput.value);
-            // console.log(`Channel ${channelNumber} value: ${rangeInput.value}`);
-        }, 70);  // Adjust delay (in milliseconds) as needed
-
-
-
-
-
-/*     rangeInput.addEventListener('input', () => {
-        ws_sendChannelVolume(name, rangeInput.value);
-        //console.log(`Main Channel ${name} value: ${rangeInput.value}`); */
+        ws_sendChannelVolume(9, rangeInput.value);
+        //console.log(`Main Channel ${name} value: ${rangeInput.value}`);
     });
 
 }
@@ -16,26 +16,86 @@
 #include "LittleFS.h"
 #include <AsyncTCP.h>
 #include <ESPAsyncWebServer.h>
+#include "src/CTRL_Link.h"
 
 
-#define UART_BUFFER_SIZE 64
+// Updates are held this long to be batched into one CTRL_Link frame
+#define LINK_BATCH_MS 2
+
+// STM32 link on UART2 (Serial2). Serial stays the USB debug console.
+#define LINK_RX_PIN 16      // from STM32 PA2 (USART2_TX)
+#define LINK_TX_PIN 17      // to STM32 PA3 (USART2_RX)
+#define LINK_CTS_PIN 18     // from STM32 PD4 (USART2_RTS)
+#define LINK_RTS_PIN 19     // to STM32 PD3 (USART2_CTS)
+#define LINK_FLOW_CONTROL 1 // 0 when RTS/CTS are not wired: the fast rates are then tried without them
+#define LINK_RTS_LEVEL 64   // RTS drops at this many bytes in the 128 byte RX FIFO
+
+// Link negotiation, see linkPoll()
+#define LINK_RETRY_MS 400     // LINK_SETUP resent this often until acknowledged
+#define LINK_SETUP_TRIES 12   // ~5 s, longer than the STM32 takes to give up a rate it was left at
+#define LINK_PING_MS 1000     // keep-alive period once up, under the STM32's 3.5 s timeout
+#define LINK_PING_MISSES 3    // unanswered pings before starting over at the safe rate
+
+// Rates proposed to the STM32, fastest first. Its USART kernel clock (96 MHz) divides all of them exactly.
+const uint32_t linkBauds[] = { 4000000, 2000000, 1000000 };
 
 // Network Credentials
 const char* ssid = "DIGIMIX";
 const char* password = "DIGIMIX";
 
 
-// Variables to track debounce
-unsigned long lastUpdateTime = 0;
-const unsigned long debounceDelay = 300;  // Debounce delay in milliseconds
-
-
 // Create server object on port 8765
 AsyncWebServer server(80);
 
 // Create websocket object
 AsyncWebSocket ws("/ws");
 
+// Updates for the STM32 not sent yet, filled by the websocket callbacks (AsyncTCP task) and sent by
+// loop() only, so nothing reaches Serial2 while loop() switches its rate. Guarded by linkMux.
+CTRL_LinkBatch linkBatch;
+uint32_t linkBatchStart;     // millis() of the oldest update in linkBatch
+uint32_t linkDropped;        // updates for a new control that found linkBatch full
+portMUX_TYPE linkMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Link rate negotiation (loop() only)
+enum LinkState
+{
+  LINK_SAFE,        // CTRL_LINK_BAUD_SAFE for good: the STM32 did not take any faster rate
+  LINK_WAIT_ACK,    // LINK_SETUP sent at the safe rate
+  LINK_TRIAL,       // switched, first ping sent
+  LINK_BACKOFF,     // trial failed, waiting for the STM32 to drop back too
+  LINK_UP           // negotiated rate answering pings
+};
+
+LinkState linkState = LINK_SAFE;
+size_t linkCandidate;       // linkBauds index being tried
+int linkTries;
+uint32_t linkDeadline;      // millis() the current state times out at
+uint32_t linkPingTime;
+uint8_t linkSeq;
+bool linkPingPending;
+int linkMisses;
+uint32_t linkBaud = CTRL_LINK_BAUD_SAFE;
+uint8_t linkFlags;
+
+// Frame being received from the STM32
+uint8_t linkRx[CTRL_LINK_MAX_ENCODED];
+size_t linkRxLen;
+bool linkRxOverflow;
+
+// Link counters, served on /link. STM32 ones arrive in LINK_STATS.
+uint32_t linkTxBytes;
+uint32_t linkTxFrames;
+uint32_t linkBadReplies;    // frames from the STM32 that failed to decode
+uint32_t linkFallbacks;     // times the link was lost and renegotiated
+uint32_t stmRxBytes;
+uint32_t stmRxFrames;
+uint32_t stmRxErrors;
+uint32_t stmRxRate;         // bytes/s between the last two LINK_STATS
+uint32_t linkTxRate;
+uint32_t linkStatsTime;
+uint32_t linkStatsTxBytes;
+
 
 // INITIALIZE littleFS //
 void initLittleFS()
@@ -86,109 +146,436 @@ void broadcastToOthers(const String &message, uint32_t excludeClientId)
 
 
 
-void sendFormattedMessage(const char* format, ...)
+// Send linkBatch to the STM32 as one frame once it is LINK_BATCH_MS old (loop() only)
+void flushLink()
 {
-  char buffer[UART_BUFFER_SIZE]; // default: 64 chars + null terminator
-  va_list args;
-  va_start(args, format);
-  vsnprintf(buffer, sizeof(buffer), format, args);
-  va_end(args);
-
-  // Ensure the message is exactly 64 chars long
-  int length = strlen(buffer);
-  if (length < UART_BUFFER_SIZE) {
-    for (int i = length; i < UART_BUFFER_SIZE; i++)
-    {
-      buffer[i] = ' '; // Padding with spaces
-    }
-    buffer[UART_BUFFER_SIZE-1] = '\0'; // Null terminator
+  uint8_t wire[CTRL_LINK_MAX_WIRE];
+  size_t n = 0;
+
+  portENTER_CRITICAL(&linkMux);
+  if (!CTRL_Link_BatchEmpty(&linkBatch) && millis() - linkBatchStart >= LINK_BATCH_MS)
+  {
+    n = CTRL_Link_BatchFinish(&linkBatch, wire);
+    linkTxBytes += n;
+    linkTxFrames++;
   }
+  portEXIT_CRITICAL(&linkMux);
 
-  Serial.println(buffer); // Send fixed-length message
+  if (n > 0)
+  {
+    Serial2.write(wire, n);
+  }
 }
 
 
 
-void handleWebSocketMessage(void *arg, uint8_t *data, size_t len, AsyncWebSocketClient *client)
+// Send one link management message in a frame of its own (loop() only)
+void sendLinkMsg(uint8_t type, uint32_t arg)
+{
+  CTRL_LinkBatch batch;
+  uint8_t wire[CTRL_LINK_MAX_WIRE];
+
+  CTRL_Link_BatchInit(&batch);
+  if (type == CTRL_MSG_LINK_PING)
+  {
+    CTRL_Link_AddLinkPing(&batch, (uint8_t)arg);
+  }
+  else
+  {
+    CTRL_Link_AddLinkSetup(&batch, type, arg, LINK_FLOW_CONTROL ? CTRL_LINK_FLOW_RTS_CTS : 0);
+  }
+  size_t n = CTRL_Link_BatchFinish(&batch, wire);
+
+  portENTER_CRITICAL(&linkMux);
+  linkTxBytes += n;
+  linkTxFrames++;
+  portEXIT_CRITICAL(&linkMux);
+
+  Serial2.write(wire, n);
+}
+
+
+
+// Switch Serial2 once what was written at the old rate has gone out
+void setLinkRate(uint32_t baud, uint8_t flags)
 {
+  Serial2.flush();
+  Serial2.setHwFlowCtrlMode((flags & CTRL_LINK_FLOW_RTS_CTS) ? UART_HW_FLOWCTRL_CTS_RTS : UART_HW_FLOWCTRL_DISABLE, LINK_RTS_LEVEL);
+  Serial2.updateBaudRate(baud);
+
+  linkBaud = baud;
+  linkFlags = flags;
+  linkRxLen = 0;
+  linkRxOverflow = false;
+}
 
-  //Debounce messages to avoid bottleneck
 
-  unsigned long currentTime = millis();
-  if(currentTime - lastUpdateTime >= debounceDelay)
+
+// Propose linkBauds[linkCandidate], or settle for the safe rate when there is none left
+void proposeLinkRate()
+{
+  if (linkCandidate >= sizeof(linkBauds) / sizeof(linkBauds[0]) || linkTries >= LINK_SETUP_TRIES)
   {
-    lastUpdateTime = currentTime;
+    linkState = LINK_SAFE;
+    Serial.printf("STM32 LINK AT %u BAUD (NO FASTER RATE ACCEPTED)\n", (unsigned)CTRL_LINK_BAUD_SAFE);
+    return;
+  }
+
+  linkTries++;
+  sendLinkMsg(CTRL_MSG_LINK_SETUP, linkBauds[linkCandidate]);
+  linkState = LINK_WAIT_ACK;
+  linkDeadline = millis() + LINK_RETRY_MS;
+}
+
+
+
+// Start (over) at the safe rate: both sides start there, and the STM32 returns to it on its own
+void startLink()
+{
+  setLinkRate(CTRL_LINK_BAUD_SAFE, 0);
+  linkCandidate = 0;
+  linkTries = 0;
+  proposeLinkRate();
+}
+
+
+
+void sendLinkPing()
+{
+  linkSeq++;
+  linkPingPending = true;
+  linkPingTime = millis();
+  sendLinkMsg(CTRL_MSG_LINK_PING, linkSeq);
+}
+
 
-    AwsFrameInfo *info = (AwsFrameInfo *)arg;
-  
-    if (info->final && info->index == 0 && info->len == len && info->opcode == WS_TEXT)
+
+// CTRL_Link_Decode handler for frames from the STM32
+void linkReceived(const CTRL_LinkMsg *msg, void *ctx)
+{
+  (void)ctx;
+
+  if (msg->type == CTRL_MSG_LINK_ACK && linkState == LINK_WAIT_ACK)
+  {
+    if (msg->baud == linkBauds[linkCandidate])
+    {
+      setLinkRate(msg->baud, msg->value);
+      sendLinkPing();
+      linkState = LINK_TRIAL;
+      linkDeadline = millis() + CTRL_LINK_TRIAL_MS;
+    }
+    else
+    {
+      // Refused: try the next rate right away
+      linkCandidate++;
+      proposeLinkRate();
+    }
+  }
+  else if (msg->type == CTRL_MSG_LINK_STATS && linkPingPending && msg->value == linkSeq)
+  {
+    uint32_t now = millis();
+    uint32_t ms = now - linkStatsTime;
+
+    if (linkState == LINK_UP && ms > 0)
     {
-      // Convert the received data to a string
-      String message = String((char *)data, len);
-      //Serial.print("Received WebSocket message: ");
-      //Serial.println(message);
+      stmRxRate = (uint32_t)((uint64_t)(msg->rxBytes - stmRxBytes) * 1000 / ms);
+      linkTxRate = (uint32_t)((uint64_t)(linkTxBytes - linkStatsTxBytes) * 1000 / ms);
+    }
+    stmRxBytes = msg->rxBytes;
+    stmRxFrames = msg->rxFrames;
+    stmRxErrors = msg->rxErrors;
+    linkStatsTime = now;
+    linkStatsTxBytes = linkTxBytes;
+
+    linkPingPending = false;
+    linkMisses = 0;
 
-      // Parse the JSON message using Arduino_JSON
-      JSONVar jsonObj = JSON.parse(message);
+    if (linkState == LINK_TRIAL)
+    {
+      linkState = LINK_UP;
+      Serial.printf("STM32 LINK UP AT %u BAUD%s\n", (unsigned)linkBaud, (linkFlags & CTRL_LINK_FLOW_RTS_CTS) ? " RTS/CTS" : "");
+    }
+  }
+}
+
+
+
+// Read what the STM32 sent: frames between 0x00 delimiters
+void receiveLink()
+{
+  while (Serial2.available() > 0)
+  {
+    uint8_t c = (uint8_t)Serial2.read();
 
-      // Check if parsing succeeded
-      if (JSON.typeof(jsonObj) == "undefined")
+    if (c != 0)
+    {
+      if (linkRxLen < sizeof(linkRx))
       {
-        Serial.println("JSON PARSING FAILED!");
-        return;
+        linkRx[linkRxLen++] = c;
+      }
+      else
+      {
+        linkRxOverflow = true;
       }
+      continue;
+    }
+
+    if (linkRxLen > 0 && (linkRxOverflow || CTRL_Link_Decode(linkRx, linkRxLen, linkReceived, NULL) != CTRL_LINK_OK))
+    {
+      linkBadReplies++;
+    }
+    linkRxLen = 0;
+    linkRxOverflow = false;
+  }
+}
 
-      // Check if "ctrl" key exists
-      if (!jsonObj.hasOwnProperty("ctrl"))
+
+
+// Rate negotiation and keep-alive, from loop(). Each step that gets no answer in time moves on:
+// an unanswered LINK_SETUP is resent, then given up for the safe rate; a trial rate whose ping goes
+// unanswered is dropped for the next one; a link that stops answering pings starts over.
+void linkPoll()
+{
+  uint32_t now = millis();
+
+  receiveLink();
+
+  switch (linkState)
+  {
+    case LINK_WAIT_ACK:
+      if ((int32_t)(now - linkDeadline) >= 0)
       {
-        Serial.println("Missing 'ctrl' KEY IN JSON!");
-        return;
+        proposeLinkRate();
+      }
+      break;
+
+    case LINK_TRIAL:
+      if ((int32_t)(now - linkDeadline) >= 0)
+      {
+        // The STM32 gives the rate up at most CTRL_LINK_TRIAL_MS + CTRL_LINK_POLL_MS after the last
+        // frame it decoded: wait that out before proposing the next one at the safe rate
+        setLinkRate(CTRL_LINK_BAUD_SAFE, 0);
+        linkCandidate++;
+        linkState = LINK_BACKOFF;
+        linkDeadline = now + CTRL_LINK_TRIAL_MS + CTRL_LINK_POLL_MS;
       }
+      break;
 
-      // Extract specific values from the JSON object
-      String ctrlChar = (const char *)jsonObj["ctrl"];  // Extract "ctrl" as a String
-      //Serial.print("Control character: ");
-      //Serial.println(ctrlChar);
+    case LINK_BACKOFF:
+      if ((int32_t)(now - linkDeadline) >= 0)
+      {
+        proposeLinkRate();
+      }
+      break;
 
-      if (ctrlChar == "v") 
-      {  
-        if (!jsonObj.hasOwnProperty("channel") || !jsonObj.hasOwnProperty("value"))
+    case LINK_UP:
+      if (now - linkPingTime >= LINK_PING_MS)
+      {
+        if (linkPingPending && ++linkMisses >= LINK_PING_MISSES)
         {
-          Serial.println("MISSING 'CHANNEL' OR 'VALUE' KEYS!");
-          return; 
+          Serial.println("STM32 LINK LOST, RENEGOTIATING");
+          linkFallbacks++;
+          linkMisses = 0;
+          startLink();
+          break;
         }
+        sendLinkPing();
+      }
+      break;
+
+    case LINK_SAFE:
+      break;
+  }
+}
+
+
+
+// Link state and counters for the UI
+String linkStatusJson()
+{
+  static const char *const stateName[] = { "safe", "negotiating", "trial", "negotiating", "up" };
+  char json[384];
+
+  snprintf(json, sizeof(json),
+           "{\"state\":\"%s\",\"baud\":%u,\"rtsCts\":%s,\"txBytes\":%u,\"txFrames\":%u,\"txRate\":%u,"
+           "\"stmRxBytes\":%u,\"stmRxFrames\":%u,\"stmRxErrors\":%u,\"stmRxRate\":%u,\"badReplies\":%u,\"fallbacks\":%u,\"dropped\":%u}",
+           stateName[linkState], (unsigned)linkBaud, (linkFlags & CTRL_LINK_FLOW_RTS_CTS) ? "true" : "false",
+           (unsigned)linkTxBytes, (unsigned)linkTxFrames, (unsigned)linkTxRate, (unsigned)stmRxBytes, (unsigned)stmRxFrames,
+           (unsigned)stmRxErrors, (unsigned)stmRxRate, (unsigned)linkBadReplies, (unsigned)linkFallbacks, (unsigned)linkDropped);
+
+  return String(json);
+}
+
+
+
+// Message in linkBatch for the same control as the encoded update m (type, channel, and band for an
+// EQ band), NULL if there is none. Called with linkMux held.
+uint8_t *findUpdate(const uint8_t *m)
+{
+  for (size_t i = 1; i < linkBatch.len; )
+  {
+    uint8_t *p = &linkBatch.payload[i];
+    size_t len = CTRL_Link_MsgLen(p, linkBatch.len - i);
+
+    if (len == 0)
+    {
+      break;
+    }
+    if (p[0] == m[0] && p[1] == m[1] && (m[0] != CTRL_MSG_EQ_BAND || p[2] == m[2]))
+    {
+      return p;
+    }
+    i += len;
+  }
+
+  return NULL;
+}
+
+// Add one update to linkBatch for loop() to send. A newer value for a control already in the batch
+// replaces the old one in place, so the batch only fills up with many different controls held back
+// by a rate trial; an update that then finds no room is dropped and counted.
+void queueUpdate(const CTRL_LinkMsg &msg)
+{
+  CTRL_LinkBatch one;
+  int added = 0;
+
+  CTRL_Link_BatchInit(&one);
+  switch (msg.type)
+  {
+    case CTRL_MSG_VOLUME:
+      added = CTRL_Link_AddVolume(&one, msg.ch, msg.value);
+      break;
+    case CTRL_MSG_EQ_BAND:
+      added = CTRL_Link_AddEqBand(&one, msg.ch, msg.band, msg.freq_Hz, msg.gain_cdB, msg.q_milli);
+      break;
+    case CTRL_MSG_MUTE:
+      added = CTRL_Link_AddMute(&one, msg.ch, msg.value);
+      break;
+  }
+  if (!added)
+  {
+    return;
+  }
+
+  const uint8_t *m = &one.payload[1];
+  size_t len = one.len - 1;
 
-        int channel = (int)jsonObj["channel"];
-        int value = (int)jsonObj["value"];
-        // Send formatted 64-char message
-        sendFormattedMessage("v,%d,%d", channel, value);
-      } 
-      else if (ctrlChar == "f")
+  portENTER_CRITICAL(&linkMux);
+  uint8_t *p = findUpdate(m);
+  if (p == NULL)
+  {
+    if (CTRL_Link_BatchEmpty(&linkBatch))
+    {
+      linkBatchStart = millis();
+    }
+    p = CTRL_Link_BatchReserve(&linkBatch, len);
+  }
+  if (p != NULL)
+  {
+    memcpy(p, m, len);
+  }
+  else
+  {
+    linkDropped++;
+  }
+  portEXIT_CRITICAL(&linkMux);
+}
+
+
+
+void handleWebSocketMessage(void *arg, uint8_t *data, size_t len, AsyncWebSocketClient *client)
+{
+
+  // No debounce here: the STM32 ramps gains and EQ coefficients, so every update is forwarded
+
+  AwsFrameInfo *info = (AwsFrameInfo *)arg;
+
+  if (info->final && info->index == 0 && info->len == len && info->opcode == WS_TEXT)
+  {
+    // Convert the received data to a string
+    String message = String((char *)data, len);
+    //Serial.print("Received WebSocket message: ");
+    //Serial.println(message);
+
+    // Parse the JSON message using Arduino_JSON
+    JSONVar jsonObj = JSON.parse(message);
+
+    // Check if parsing succeeded
+    if (JSON.typeof(jsonObj) == "undefined")
+    {
+      Serial.println("JSON PARSING FAILED!");
+      return;
+    }
+
+    // Check if "ctrl" key exists
+    if (!jsonObj.hasOwnProperty("ctrl"))
+    {
+      Serial.println("Missing 'ctrl' KEY IN JSON!");
+      return;
+    }
+
+    // Extract specific values from the JSON object
+    String ctrlChar = (const char *)jsonObj["ctrl"];  // Extract "ctrl" as a String
+    //Serial.print("Control character: ");
+    //Serial.println(ctrlChar);
+
+    if (ctrlChar == "v") 
+    {  
+      if (!jsonObj.hasOwnProperty("channel") || !jsonObj.hasOwnProperty("value"))
       {
-        if (JSON.typeof(jsonObj["channel"]) == "undefined" || JSON.typeof(jsonObj["filter_id"]) == "undefined" || JSON.typeof(jsonObj["frequency"]) == "undefined" ||  JSON.typeof(jsonObj["gain"]) == "undefined" || JSON.typeof(jsonObj["q"]) == "undefined")
-          {
-            Serial.println("MISSING OR INVALID KEYS!");
-            return;
-          }
-
-        int channel = (int)jsonObj["channel"];
-        int filter_id = (int)jsonObj["filter_id"];
-        int frequency = (int)jsonObj["frequency"];
-        double gain = (double)jsonObj["gain"];
-        double q = (double)jsonObj["q"];
-
-        // Send formatted 64-char message
-        sendFormattedMessage("f,%d,%d,%d,%.1f,%.1f", channel, filter_id, frequency, gain, q);
-      } 
-      else
+        Serial.println("MISSING 'CHANNEL' OR 'VALUE' KEYS!");
+        return; 
+      }
+
+      CTRL_LinkMsg msg = {};
+      msg.type = CTRL_MSG_VOLUME;
+      msg.ch = (int)jsonObj["channel"];
+      msg.value = constrain((int)jsonObj["value"], 0, 100);
+      queueUpdate(msg);
+    } 
+    else if (ctrlChar == "m")
+    {
+      if (!jsonObj.hasOwnProperty("channel") || !jsonObj.hasOwnProperty("value"))
       {
-        Serial.println("UNKNOWN CONTROL CHARACTER!");
+        Serial.println("MISSING 'CHANNEL' OR 'VALUE' KEYS!");
+        return;
       }
 
-      // Broadcast message to other clients after successful processing
-      broadcastToOthers(message, client->id());
+      CTRL_LinkMsg msg = {};
+      msg.type = CTRL_MSG_MUTE;
+      msg.ch = (int)jsonObj["channel"];
+      msg.value = ((int)jsonObj["value"] != 0);
+      queueUpdate(msg);
+    }
+    else if (ctrlChar == "f")
+    {
+      if (JSON.typeof(jsonObj["channel"]) == "undefined" || JSON.typeof(jsonObj["filter_id"]) == "undefined" || JSON.typeof(jsonObj["frequency"]) == "undefined" ||  JSON.typeof(jsonObj["gain"]) == "undefined" || JSON.typeof(jsonObj["q"]) == "undefined")
+        {
+          Serial.println("MISSING OR INVALID KEYS!");
+          return;
+        }
 
+      double gain = (double)jsonObj["gain"];
+      double q = (double)jsonObj["q"];
+
+      // Gain in 0.01 dB, Q in 0.001 steps
+      CTRL_LinkMsg msg = {};
+      msg.type = CTRL_MSG_EQ_BAND;
+      msg.ch = (int)jsonObj["channel"];
+      msg.band = (int)jsonObj["filter_id"];
+      msg.freq_Hz = constrain((int)jsonObj["frequency"], 0, 65535);
+      msg.gain_cdB = constrain(lround(gain * 100.0), -32768L, 32767L);
+      msg.q_milli = constrain(lround(q * 1000.0), 0L, 65535L);
+      queueUpdate(msg);
+    } 
+    else
+    {
+      Serial.println("UNKNOWN CONTROL CHARACTER!");
     }
+
+    // Broadcast message to other clients after successful processing
+    broadcastToOthers(message, client->id());
+
   }
 }
 
@@ -229,6 +616,11 @@ void initWebSocket()
 void setup()
 {
   Serial.begin(115200);
+  Serial2.begin(CTRL_LINK_BAUD_SAFE, SERIAL_8N1, LINK_RX_PIN, LINK_TX_PIN);
+#if LINK_FLOW_CONTROL
+  Serial2.setPins(LINK_RX_PIN, LINK_TX_PIN, LINK_CTS_PIN, LINK_RTS_PIN);
+#endif
+  CTRL_Link_BatchInit(&linkBatch);
 
   initWiFi();
   initLittleFS();
@@ -242,11 +634,16 @@ void setup()
     //Serial.println("/ Requested");
   });
 
+  server.on("/link", HTTP_GET, [](AsyncWebServerRequest *request) {
+    request->send(200, "application/json", linkStatusJson());
+  });
+
   server.serveStatic("/", LittleFS, "/");
 
   // Start server
   server.begin();
 
+  startLink();
 }
 
 
@@ -254,7 +651,13 @@ void setup()
 
 void loop()
 {
-  // Do nothing for now, all is handled on server begin
+  // All is handled on server begin, this only runs the STM32 link: rate negotiation and keep-alive,
+  // and the batched updates, held while a trial rate may still be dropped
   ws.cleanupClients();
+  linkPoll();
+  if (linkState != LINK_TRIAL && linkState != LINK_BACKOFF)
+  {
+    flushLink();
+  }
 
 }
\ No newline at end of file
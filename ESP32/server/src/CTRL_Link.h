@@ -0,0 +1,450 @@
+/*
+ * CTRL_Link.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef CTRL_LINK_H_
+#define CTRL_LINK_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Binary control protocol between the ESP32 UI server and the STM32 mixer. Header only and shared:
+// server.ino includes it from its src/ folder, the CM7 build has this folder on its include path.
+//
+// Frame on the wire:   0x00  COBS(payload)  0x00
+// payload:             version | message | message ... | CRC16
+//
+// The CRC (CCITT-FALSE: poly 0x1021, init 0xFFFF, little endian on the wire) covers the version and
+// the messages. COBS removes every 0x00 from the payload, so the delimiters cannot occur inside a
+// frame; the leading one also lets frames share the UART with '\n' terminated ASCII commands.
+//
+// Messages are a type byte and fixed fields, multi-byte fields little endian:
+//   VOLUME        ch, volume (0..100)                                                3 bytes
+//   EQ_BAND       ch, band, freq (Hz, u16), gain (0.01 dB, s16), Q (0.001, u16)      9 bytes
+//   MUTE          ch, on                                                             3 bytes
+//   VOLUME_BULK   first ch, count, count volumes                                     3 + count bytes
+// Channel CTRL_LINK_MASTER is the master fader. As many messages as fit in CTRL_LINK_MAX_PAYLOAD can
+// be batched in one frame.
+//
+// Link management, each sent in a frame of its own so a peer that does not know it only loses that:
+//   LINK_SETUP    ESP32 -> STM32: baud (u32), flags. Sent at CTRL_LINK_BAUD_SAFE      6 bytes
+//   LINK_ACK      STM32 -> ESP32: the accepted baud and flags, baud 0 if refused     6 bytes
+//   LINK_PING     ESP32 -> STM32: seq                                                2 bytes
+//   LINK_STATS    STM32 -> ESP32, answers a ping: seq, then the STM32's receive      14 bytes
+//                 counters as u32: bytes, frames applied, errors (all causes)
+// After LINK_ACK both sides switch; a side that then hears nothing valid goes back to
+// CTRL_LINK_BAUD_SAFE without flow control, which is also where both start.
+//
+// CTRL_Link_Decode checks a whole frame (COBS, CRC, version, every message complete and known)
+// before handing out any message, so a damaged frame changes nothing.
+
+#define CTRL_LINK_VERSION 1
+
+#define CTRL_LINK_MASTER 9
+
+// Version, messages and CRC
+#define CTRL_LINK_MAX_PAYLOAD 128
+
+// COBS adds one byte per 254, plus one
+#define CTRL_LINK_MAX_ENCODED (CTRL_LINK_MAX_PAYLOAD + CTRL_LINK_MAX_PAYLOAD / 254 + 1)
+
+// Encoded frame with both delimiters
+#define CTRL_LINK_MAX_WIRE (CTRL_LINK_MAX_ENCODED + 2)
+
+#define CTRL_MSG_VOLUME 0x01
+#define CTRL_MSG_EQ_BAND 0x02
+#define CTRL_MSG_MUTE 0x03
+#define CTRL_MSG_VOLUME_BULK 0x04
+#define CTRL_MSG_LINK_SETUP 0x10
+#define CTRL_MSG_LINK_ACK 0x11
+#define CTRL_MSG_LINK_PING 0x12
+#define CTRL_MSG_LINK_STATS 0x13
+
+// Link rate both sides start at and fall back to
+#define CTRL_LINK_BAUD_SAFE 115200
+
+// Negotiation timing shared by both sides. After LINK_ACK the STM32 drops the new rate when no valid
+// frame arrives within CTRL_LINK_TRIAL_MS, checked every CTRL_LINK_POLL_MS, so it is back at the safe
+// rate at most CTRL_LINK_TRIAL_MS + CTRL_LINK_POLL_MS after the last frame it decoded.
+#define CTRL_LINK_TRIAL_MS 300
+#define CTRL_LINK_POLL_MS 100
+
+// LINK_SETUP / LINK_ACK flags
+#define CTRL_LINK_FLOW_RTS_CTS 0x01
+
+typedef enum {
+	CTRL_LINK_OK = 0,
+	CTRL_LINK_ERR_COBS,
+	CTRL_LINK_ERR_CRC,
+	CTRL_LINK_ERR_VERSION,
+	CTRL_LINK_ERR_MSG,
+} CTRL_LinkStatus;
+
+// One decoded update. VOLUME_BULK is handed out as one VOLUME per channel.
+typedef struct {
+	uint8_t type;
+	uint8_t ch;
+	uint8_t value;			// VOLUME: volume, MUTE: on, LINK_SETUP/ACK: flags, LINK_PING/STATS: seq
+	uint8_t band;			// EQ_BAND fields
+	uint16_t freq_Hz;
+	int16_t gain_cdB;
+	uint16_t q_milli;
+	uint32_t baud;			// LINK_SETUP / LINK_ACK
+	uint32_t rxBytes;		// LINK_STATS fields
+	uint32_t rxFrames;
+	uint32_t rxErrors;
+} CTRL_LinkMsg;
+
+typedef void (*CTRL_LinkHandler)(const CTRL_LinkMsg *msg, void *ctx);
+
+// Frame under construction: payload[0] is the version, messages follow
+typedef struct {
+	uint8_t payload[CTRL_LINK_MAX_PAYLOAD];
+	size_t len;
+} CTRL_LinkBatch;
+
+static inline uint16_t CTRL_Link_Crc16(const uint8_t *data, size_t n) {
+
+	uint16_t crc = 0xFFFF;
+
+	for (size_t i = 0; i < n; i++) {
+		crc ^= (uint16_t) data[i] << 8;
+		for (int b = 0; b < 8; b++) {
+			crc = (crc & 0x8000) ? (uint16_t) ((crc << 1) ^ 0x1021) : (uint16_t) (crc << 1);
+		}
+	}
+
+	return crc;
+}
+
+// out holds at least n + n / 254 + 1 bytes. Returns the encoded length (no delimiters).
+static inline size_t CTRL_Link_CobsEncode(const uint8_t *in, size_t n, uint8_t *out) {
+
+	size_t code = 0;		// where the current group's length byte goes
+	size_t o = 1;
+
+	for (size_t i = 0; i < n; i++) {
+		if (in[i] != 0) {
+			out[o++] = in[i];
+		}
+		if (in[i] == 0 || o - code == 0xFF) {
+			out[code] = (uint8_t) (o - code);
+			code = o++;
+		}
+	}
+	out[code] = (uint8_t) (o - code);
+
+	return o;
+}
+
+// Returns the decoded length, 0 if the input is not valid COBS or does not fit in outMax
+static inline size_t CTRL_Link_CobsDecode(const uint8_t *in, size_t n, uint8_t *out, size_t outMax) {
+
+	size_t o = 0;
+	size_t i = 0;
+
+	while (i < n) {
+		uint8_t code = in[i++];
+
+		if (code == 0 || i + code - 1 > n) {
+			return 0;
+		}
+		for (uint8_t k = 1; k < code; k++) {
+			if (in[i] == 0 || o == outMax) {
+				return 0;
+			}
+			out[o++] = in[i++];
+		}
+		if (code != 0xFF && i < n) {
+			if (o == outMax) {
+				return 0;
+			}
+			out[o++] = 0;
+		}
+	}
+
+	return o;
+}
+
+static inline void CTRL_Link_Put32(uint8_t *p, uint32_t v) {
+	p[0] = (uint8_t) v;
+	p[1] = (uint8_t) (v >> 8);
+	p[2] = (uint8_t) (v >> 16);
+	p[3] = (uint8_t) (v >> 24);
+}
+
+static inline uint32_t CTRL_Link_Get32(const uint8_t *p) {
+	return (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+static inline void CTRL_Link_BatchInit(CTRL_LinkBatch *b) {
+	b->payload[0] = CTRL_LINK_VERSION;
+	b->len = 1;
+}
+
+static inline int CTRL_Link_BatchEmpty(const CTRL_LinkBatch *b) {
+	return b->len <= 1;
+}
+
+// Room for a message of n bytes, keeping two for the CRC
+static inline uint8_t *CTRL_Link_BatchReserve(CTRL_LinkBatch *b, size_t n) {
+
+	if (b->len + n + 2 > CTRL_LINK_MAX_PAYLOAD) {
+		return NULL;
+	}
+
+	uint8_t *p = &b->payload[b->len];
+	b->len += n;
+
+	return p;
+}
+
+// The Add functions return 0 when the batch is full: finish it, start a new one and add again
+static inline int CTRL_Link_AddVolume(CTRL_LinkBatch *b, uint8_t ch, uint8_t volume) {
+
+	uint8_t *p = CTRL_Link_BatchReserve(b, 3);
+	if (p == NULL) {
+		return 0;
+	}
+
+	p[0] = CTRL_MSG_VOLUME;
+	p[1] = ch;
+	p[2] = volume;
+
+	return 1;
+}
+
+static inline int CTRL_Link_AddEqBand(CTRL_LinkBatch *b, uint8_t ch, uint8_t band, uint16_t freq_Hz, int16_t gain_cdB, uint16_t q_milli) {
+
+	uint8_t *p = CTRL_Link_BatchReserve(b, 9);
+	if (p == NULL) {
+		return 0;
+	}
+
+	p[0] = CTRL_MSG_EQ_BAND;
+	p[1] = ch;
+	p[2] = band;
+	p[3] = (uint8_t) freq_Hz;
+	p[4] = (uint8_t) (freq_Hz >> 8);
+	p[5] = (uint8_t) (uint16_t) gain_cdB;
+	p[6] = (uint8_t) ((uint16_t) gain_cdB >> 8);
+	p[7] = (uint8_t) q_milli;
+	p[8] = (uint8_t) (q_milli >> 8);
+
+	return 1;
+}
+
+static inline int CTRL_Link_AddMute(CTRL_LinkBatch *b, uint8_t ch, uint8_t on) {
+
+	uint8_t *p = CTRL_Link_BatchReserve(b, 3);
+	if (p == NULL) {
+		return 0;
+	}
+
+	p[0] = CTRL_MSG_MUTE;
+	p[1] = ch;
+	p[2] = (on != 0);
+
+	return 1;
+}
+
+static inline int CTRL_Link_AddVolumeBulk(CTRL_LinkBatch *b, uint8_t first, uint8_t count, const uint8_t *volumes) {
+
+	uint8_t *p = CTRL_Link_BatchReserve(b, 3 + (size_t) count);
+	if (p == NULL) {
+		return 0;
+	}
+
+	p[0] = CTRL_MSG_VOLUME_BULK;
+	p[1] = first;
+	p[2] = count;
+	for (uint8_t k = 0; k < count; k++) {
+		p[3 + k] = volumes[k];
+	}
+
+	return 1;
+}
+
+// type is CTRL_MSG_LINK_SETUP or CTRL_MSG_LINK_ACK
+static inline int CTRL_Link_AddLinkSetup(CTRL_LinkBatch *b, uint8_t type, uint32_t baud, uint8_t flags) {
+
+	uint8_t *p = CTRL_Link_BatchReserve(b, 6);
+	if (p == NULL) {
+		return 0;
+	}
+
+	p[0] = type;
+	CTRL_Link_Put32(&p[1], baud);
+	p[5] = flags;
+
+	return 1;
+}
+
+static inline int CTRL_Link_AddLinkPing(CTRL_LinkBatch *b, uint8_t seq) {
+
+	uint8_t *p = CTRL_Link_BatchReserve(b, 2);
+	if (p == NULL) {
+		return 0;
+	}
+
+	p[0] = CTRL_MSG_LINK_PING;
+	p[1] = seq;
+
+	return 1;
+}
+
+static inline int CTRL_Link_AddLinkStats(CTRL_LinkBatch *b, uint8_t seq, uint32_t rxBytes, uint32_t rxFrames, uint32_t rxErrors) {
+
+	uint8_t *p = CTRL_Link_BatchReserve(b, 14);
+	if (p == NULL) {
+		return 0;
+	}
+
+	p[0] = CTRL_MSG_LINK_STATS;
+	p[1] = seq;
+	CTRL_Link_Put32(&p[2], rxBytes);
+	CTRL_Link_Put32(&p[6], rxFrames);
+	CTRL_Link_Put32(&p[10], rxErrors);
+
+	return 1;
+}
+
+// Append the CRC and write the frame, delimiters included, to wire (CTRL_LINK_MAX_WIRE bytes).
+// Returns its length; the batch is left empty.
+static inline size_t CTRL_Link_BatchFinish(CTRL_LinkBatch *b, uint8_t *wire) {
+
+	uint16_t crc = CTRL_Link_Crc16(b->payload, b->len);
+
+	b->payload[b->len++] = (uint8_t) crc;
+	b->payload[b->len++] = (uint8_t) (crc >> 8);
+
+	wire[0] = 0;
+	size_t n = 1 + CTRL_Link_CobsEncode(b->payload, b->len, &wire[1]);
+	wire[n++] = 0;
+
+	CTRL_Link_BatchInit(b);
+
+	return n;
+}
+
+// Length of the message at p, 0 if it is unknown or runs past the n bytes left
+static inline size_t CTRL_Link_MsgLen(const uint8_t *p, size_t n) {
+
+	size_t len;
+
+	switch (p[0]) {
+	case CTRL_MSG_VOLUME:
+	case CTRL_MSG_MUTE:
+		len = 3;
+		break;
+	case CTRL_MSG_EQ_BAND:
+		len = 9;
+		break;
+	case CTRL_MSG_LINK_SETUP:
+	case CTRL_MSG_LINK_ACK:
+		len = 6;
+		break;
+	case CTRL_MSG_LINK_PING:
+		len = 2;
+		break;
+	case CTRL_MSG_LINK_STATS:
+		len = 14;
+		break;
+	case CTRL_MSG_VOLUME_BULK:
+		len = (n >= 3) ? 3 + (size_t) p[2] : 3;
+		break;
+	default:
+		return 0;
+	}
+
+	return (len <= n) ? len : 0;
+}
+
+// enc is one frame without its delimiters. handler is called once per update, in frame order, only
+// if the whole frame is valid.
+static inline CTRL_LinkStatus CTRL_Link_Decode(const uint8_t *enc, size_t n, CTRL_LinkHandler handler, void *ctx) {
+
+	uint8_t payload[CTRL_LINK_MAX_PAYLOAD];
+	size_t len = CTRL_Link_CobsDecode(enc, n, payload, sizeof(payload));
+
+	if (len < 3) {
+		return CTRL_LINK_ERR_COBS;
+	}
+
+	len -= 2;
+	if (CTRL_Link_Crc16(payload, len) != (uint16_t) (payload[len] | (payload[len + 1] << 8))) {
+		return CTRL_LINK_ERR_CRC;
+	}
+
+	if (payload[0] != CTRL_LINK_VERSION) {
+		return CTRL_LINK_ERR_VERSION;
+	}
+
+	// Check every message, then hand them out
+	for (size_t i = 1; i < len; ) {
+		size_t msgLen = CTRL_Link_MsgLen(&payload[i], len - i);
+		if (msgLen == 0) {
+			return CTRL_LINK_ERR_MSG;
+		}
+		i += msgLen;
+	}
+
+	for (size_t i = 1; i < len; ) {
+		const uint8_t *p = &payload[i];
+		CTRL_LinkMsg msg;
+
+		msg.type = p[0];
+		msg.ch = p[1];
+		msg.value = 0;
+		msg.band = 0;
+		msg.freq_Hz = 0;
+		msg.gain_cdB = 0;
+		msg.q_milli = 0;
+		msg.baud = 0;
+		msg.rxBytes = 0;
+		msg.rxFrames = 0;
+		msg.rxErrors = 0;
+
+		if (p[0] == CTRL_MSG_VOLUME_BULK) {
+			msg.type = CTRL_MSG_VOLUME;
+			for (uint8_t k = 0; k < p[2]; k++) {
+				msg.ch = (uint8_t) (p[1] + k);
+				msg.value = p[3 + k];
+				handler(&msg, ctx);
+			}
+		} else if (p[0] == CTRL_MSG_EQ_BAND) {
+			msg.band = p[2];
+			msg.freq_Hz = (uint16_t) (p[3] | (p[4] << 8));
+			msg.gain_cdB = (int16_t) (uint16_t) (p[5] | (p[6] << 8));
+			msg.q_milli = (uint16_t) (p[7] | (p[8] << 8));
+			handler(&msg, ctx);
+		} else if (p[0] == CTRL_MSG_LINK_SETUP || p[0] == CTRL_MSG_LINK_ACK) {
+			msg.ch = 0;
+			msg.baud = CTRL_Link_Get32(&p[1]);
+			msg.value = p[5];
+			handler(&msg, ctx);
+		} else if (p[0] == CTRL_MSG_LINK_STATS) {
+			msg.ch = 0;
+			msg.value = p[1];
+			msg.rxBytes = CTRL_Link_Get32(&p[2]);
+			msg.rxFrames = CTRL_Link_Get32(&p[6]);
+			msg.rxErrors = CTRL_Link_Get32(&p[10]);
+			handler(&msg, ctx);
+		} else if (p[0] == CTRL_MSG_LINK_PING) {
+			msg.ch = 0;
+			msg.value = p[1];
+			handler(&msg, ctx);
+		} else {
+			msg.value = p[2];
+			handler(&msg, ctx);
+		}
+
+		i += CTRL_Link_MsgLen(p, len - i);
+	}
+
+	return CTRL_LINK_OK;
+}
+
+#endif /* CTRL_LINK_H_ */
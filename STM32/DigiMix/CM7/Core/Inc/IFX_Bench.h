@@ -0,0 +1,36 @@
+/*
+ * IFX_Bench.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef INC_IFX_BENCH_H_
+#define INC_IFX_BENCH_H_
+
+#include <stdint.h>
+
+// Block length used for every kernel (same as one audio block)
+#define IFX_BENCH_BLOCK_SIZE 48
+
+// Blocks per timed run, and runs per kernel (the fastest run is kept to filter out preemption)
+#define IFX_BENCH_BLOCKS 64
+#define IFX_BENCH_RUNS 8
+
+#define IFX_BENCH_MAX_RESULTS 24
+
+typedef struct {
+	const char *name;
+
+	// Cost of one item (one sample, or one call for the control path kernels)
+	float cyclesPerItem;
+	float nsPerItem;
+
+	// Share of the per-sample deadline at the bench sample rate left over, per channel.
+	// Only meaningful for per-sample kernels, 0 for per-call ones
+	float headroomPct;
+	uint8_t perSample;
+} IFX_BenchResult;
+
+uint32_t IFX_Bench_RunAll(IFX_BenchResult *results, uint32_t maxResults, float sampleRate_Hz);
+
+#endif /* INC_IFX_BENCH_H_ */
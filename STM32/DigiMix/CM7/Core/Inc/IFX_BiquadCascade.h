@@ -0,0 +1,58 @@
+/*
+ * IFX_BiquadCascade.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef INC_IFX_BIQUADCASCADE_H_
+#define INC_IFX_BIQUADCASCADE_H_
+
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "IFX_PeakingFilter.h"
+
+// Maximum number of second-order sections per channel (UI allows 5 EQ bands)
+#define IFX_BIQUADCASCADE_MAX_STAGES 5
+
+// Coefficients per stage {b0, b1, b2, -a1, -a2} and state per stage {s1, s2}
+#define IFX_BIQUADCASCADE_COEFS 5
+#define IFX_BIQUADCASCADE_STATES 2
+
+// Coefficient banks: one latched by the audio path, one published, one free for the control side
+#define IFX_BIQUADCASCADE_BANKS 3
+
+typedef struct {
+	// Sample Time
+	float sampleTime_s;
+
+	// Number of stages in use
+	uint32_t numStages;
+
+	// Stage coefficients, packed stage after stage, one full set per bank
+	float coef[IFX_BIQUADCASCADE_BANKS][IFX_BIQUADCASCADE_MAX_STAGES * IFX_BIQUADCASCADE_COEFS];
+
+	// Bank last published by the control side
+	atomic_uint published;
+
+	// Bank latched by the audio path for the block it is processing
+	atomic_uint active;
+
+	// Audio side: coefficients actually used, ramped towards the latched bank over smoothBlocks
+	// blocks. Linear interpolation keeps the poles stable since the stable (a1, a2) region is convex.
+	float coefRun[IFX_BIQUADCASCADE_MAX_STAGES * IFX_BIQUADCASCADE_COEFS];
+	float coefStep[IFX_BIQUADCASCADE_MAX_STAGES * IFX_BIQUADCASCADE_COEFS];
+	uint32_t smoothBlocks;
+	uint32_t blocksLeft;
+	uint32_t runBank;
+
+	// Transposed direct form II state, packed stage after stage
+	float state[IFX_BIQUADCASCADE_MAX_STAGES * IFX_BIQUADCASCADE_STATES];
+} IFX_BiquadCascade;
+
+void IFX_BiquadCascade_Init(IFX_BiquadCascade *casc, float sampleRate_Hz, uint32_t numStages);
+void IFX_BiquadCascade_SetSmoothing(IFX_BiquadCascade *casc, uint32_t blocks);
+void IFX_BiquadCascade_SetPeaking(IFX_BiquadCascade *casc, uint32_t stage, float centerFrequency_Hz, float Q, float boostCut_linear);
+void IFX_BiquadCascade_ProcessBlock(IFX_BiquadCascade *casc, const float *in, float *out, uint32_t n);
+
+#endif /* INC_IFX_BIQUADCASCADE_H_ */
@@ -0,0 +1,29 @@
+/*
+ * IFX_CoefDesign.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef INC_IFX_COEFDESIGN_H_
+#define INC_IFX_COEFDESIGN_H_
+
+#include <stdint.h>
+
+// Single precision pi (M_PI is not part of ISO C and promotes expressions to double)
+#define IFX_PI 3.14159265358979f
+
+// Fast replacements for the libm calls on the control path. Error bounds are measured
+// against double precision tan / pow over the whole input range:
+//
+//   IFX_TanPi       |rel. error| < 3e-7 for x in [0, 0.45]  (up to 21.6 kHz at 48 kHz)
+//                   |rel. error| < 2e-6 for x in [0.45, 0.49], dominated by rounding x to float
+//                   next to the pole, tanf(M_PI * x) does the same
+//   IFX_DbToLinear  |rel. error| < 1e-6 for dB in [-120, +40]  (powf: 5e-7)
+//
+// i.e. a few float ULP, far below anything audible in the filter response.
+
+float IFX_TanPi(float x);
+float IFX_DbToLinear(float dB);
+float IFX_VolumeToLinear(uint8_t volume);
+
+#endif /* INC_IFX_COEFDESIGN_H_ */
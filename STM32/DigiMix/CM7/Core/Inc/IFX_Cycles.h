@@ -0,0 +1,54 @@
+/*
+ * IFX_Cycles.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef INC_IFX_CYCLES_H_
+#define INC_IFX_CYCLES_H_
+
+#include <stdint.h>
+
+// Cycle / time stamps for profiling. On the CM7 this is the DWT cycle counter; on a host build it
+// falls back to CLOCK_MONOTONIC in nanoseconds, so IFX_CYCLES_PER_SECOND is 1e9 there.
+
+#if defined(CORE_CM7)
+
+#include "stm32h7xx.h"
+
+#define IFX_CYCLES_PER_SECOND ((float) SystemCoreClock)
+
+static inline void IFX_Cycles_Init(void) {
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;		// Unlock DWT access on the M7
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static inline uint32_t IFX_Cycles_Now(void) {
+	return DWT->CYCCNT;
+}
+
+#else
+
+#include <time.h>
+
+#define IFX_CYCLES_PER_SECOND 1.0e9f
+
+static inline void IFX_Cycles_Init(void) {
+}
+
+static inline uint32_t IFX_Cycles_Now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t) ((uint64_t) ts.tv_sec * 1000000000ull + (uint64_t) ts.tv_nsec);
+}
+
+#endif
+
+// Elapsed count between two stamps, correct across one counter wrap
+static inline uint32_t IFX_Cycles_Since(uint32_t start) {
+	return IFX_Cycles_Now() - start;
+}
+
+#endif /* INC_IFX_CYCLES_H_ */
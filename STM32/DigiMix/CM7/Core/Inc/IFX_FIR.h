@@ -0,0 +1,45 @@
+/*
+ * IFX_FIR.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef INC_IFX_FIR_H_
+#define INC_IFX_FIR_H_
+
+#include <stdint.h>
+
+// Longest filter an IFX_FIR instance can hold
+#define IFX_FIR_MAX_TAPS 96
+
+// Direct form FIR with a mirrored delay line: every input is written twice, N taps apart, so the
+// last N inputs are always contiguous (newest first) and the inner loop is a plain dot product
+// with no wraparound checks.
+typedef struct {
+	// Coefficients h[0..numTaps-1], not copied (may be shared between instances)
+	const float *coef;
+	uint32_t numTaps;
+
+	// Position of the newest input in the first half of the delay line
+	uint32_t index;
+
+	// Delay line, two copies back to back
+	float state[2 * IFX_FIR_MAX_TAPS];
+} IFX_FIR;
+
+void IFX_FIR_Init(IFX_FIR *fir, const float *coef, uint32_t numTaps);
+void IFX_FIR_Reset(IFX_FIR *fir);
+float IFX_FIR_Update(IFX_FIR *fir, float inp);
+void IFX_FIR_ProcessBlock(IFX_FIR *fir, const float *in, float *out, uint32_t n);
+
+// Split form for multirate use: Push adds an input without computing an output, Dot computes the
+// output for the current delay line with any numTaps-long coefficient set (e.g. a polyphase branch)
+void IFX_FIR_Push(IFX_FIR *fir, float inp);
+float IFX_FIR_Dot(const IFX_FIR *fir, const float *coef);
+
+// Kaiser-windowed sinc low-pass, normalised to unity DC gain. cutoff is a fraction of fs (-6 dB
+// point), attenuation_dB sets the window (and with numTaps, the transition width).
+// Control path only: uses double precision sin/sqrt.
+void IFX_FIR_DesignLowpass(float *coef, uint32_t numTaps, float cutoff, float attenuation_dB);
+
+#endif /* INC_IFX_FIR_H_ */
@@ -0,0 +1,31 @@
+/*
+ * IFX_FastMem.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef INC_IFX_FASTMEM_H_
+#define INC_IFX_FASTMEM_H_
+
+// Placement of the audio path in the M7's tightly coupled memories: zero wait states and never
+// cached, so block time no longer depends on what the control side did to the caches. The sections
+// are laid out in the linker scripts and filled by Reset_Handler before main().
+//
+// DSP_FAST_CODE  function in ITCM (64 KB). Calls to and from flash go through linker veneers.
+// DSP_FAST_BSS   zero-initialized variable in DTCM (128 KB)
+//
+// Only the CPU (and MDMA) can reach DTCM: never use it for DMA1/DMA2 buffers. There is no
+// initialized DTCM section: coefficient tables are computed into DSP_FAST_BSS at init, and const
+// tables stay in flash.
+//
+// Outside the CM7 build (host benches) the macros are empty.
+
+#if defined(CORE_CM7)
+#define DSP_FAST_CODE __attribute__((section(".itcm_text")))
+#define DSP_FAST_BSS __attribute__((section(".dtcm_bss")))
+#else
+#define DSP_FAST_CODE
+#define DSP_FAST_BSS
+#endif
+
+#endif /* INC_IFX_FASTMEM_H_ */
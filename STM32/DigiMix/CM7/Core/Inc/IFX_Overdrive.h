@@ -14,38 +14,60 @@
 #include <stdint.h>
 #include <math.h>
 
-// input low-pass filter (fc = fs / 4) 0.25dB ripple in pass-band, 60dB attenuation at stop-band, 69 taps
-// http://t-filter.engineerjs.com/
+#include "IFX_FIR.h"
+
+// input low-pass filter (fc = fs / 4) 60dB attenuation at stop-band, 69 taps
+// Designed at start-up from this spec (Kaiser-windowed sinc) rather than pasted from a design tool:
+// beta = 0.1102 * (60 - 8.7) gives >= 60 dB stop-band and ~0.01 dB pass-band ripple (spec was
+// 0.25 dB), with the transition band (~0.053 fs wide) centred on fs / 4.
 
 #define IFX_OVERDRIVE_LPF_INP_LENGTH 69
+#define IFX_OVERDRIVE_LPF_INP_CUTOFF 0.25f		// fraction of fs
+#define IFX_OVERDRIVE_LPF_INP_ATTEN_DB 60.0f
 
 // coefficients of the FIR filter
 extern float IFX_OD_LPF_INP_COEF[IFX_OVERDRIVE_LPF_INP_LENGTH];
 
+// Oversampling of the clipper (1 = off, 2 or 4). The clipper input is interpolated and its output
+// decimated with polyphase filters, so only the non-zero interpolator taps and the decimator outputs
+// that are kept get computed. Prototype low-pass: IFX_OVERDRIVE_OS_PHASE_TAPS taps per phase, 80 dB
+// Kaiser window, -6 dB at 0.45 * base fs (flat to ~16.5 kHz, >= 80 dB from ~26.5 kHz at 48 kHz).
+#define IFX_OVERDRIVE_OS_MAX_FACTOR 4
+#define IFX_OVERDRIVE_OS_PHASE_TAPS 24
+#define IFX_OVERDRIVE_OS_CUTOFF 0.45f		// fraction of base fs
+#define IFX_OVERDRIVE_OS_ATTEN_DB 80.0f
+
 typedef struct {
 	// Sampling time
 	float T;
 
 	// Input low-pass filter
-	float 	lpfInpBuf[IFX_OVERDRIVE_LPF_INP_LENGTH];
-	uint8_t lpfInpBufIndex;
+	IFX_FIR lpfInp;
 	float 	lpfInpOut;
 
 	// Input high-pass filter
 	float hpfInpBufIn[2];
 	float hpfInpBufOut[2];
 	float hpfInpWcT;
+	float hpfInpCoef[2];	// {2 / (2 + wcT), (2 - wcT) / (2 + wcT)}
 	float hpfInpOut;
 
 	// Overdrive settings
 	float preGain;
 	float threshold;
 
+	// Oversampling: factor requested by the control side, latched by the audio path per block
+	volatile uint8_t osRequest;
+	uint8_t osFactor;
+	IFX_FIR osInterp;		// base-rate clipper input, IFX_OVERDRIVE_OS_PHASE_TAPS long
+	IFX_FIR osDecim;		// oversampled clipper output, osFactor * IFX_OVERDRIVE_OS_PHASE_TAPS long
+
 	// Output low-pass filter
 	float lpfOutBufIn[3];
 	float lpfOutBufOut[3];
 	float lpfOutWcT;
 	float lpfOutDamp;
+	float lpfOutCoef[3];	// {wcT^2, -(2 wcT^2 - 8), -(4 - 4 d wcT + wcT^2)} / (4 + 4 d wcT + wcT^2)
 	float lpfOutOut;
 
 	float out;
@@ -54,6 +76,9 @@ typedef struct {
 void IFX_Overdrive_Init(IFX_Overdrive *od, float sampleRate_Hz, float hpfCutoffFrequencyHz, float odPreGain, float lpfCutoffFrequencyHz, float lpfDamping);
 void IFX_Overdrive_SetHPF(IFX_Overdrive *od, float hpfCutoffFrequencyHz);
 void IFX_Overdrive_SetLPF(IFX_Overdrive *od, float lpfCutoffFrequencyHz, float lpfDamping);
+void IFX_Overdrive_SetPreGain(IFX_Overdrive *od, float odPreGain);
+void IFX_Overdrive_SetOversampling(IFX_Overdrive *od, uint8_t factor);
 float IFX_Overdrive_Update(IFX_Overdrive *od, float inp);
+void IFX_Overdrive_ProcessBlock(IFX_Overdrive *od, const float *in, float *out, uint32_t n);
 
 #endif /* INC_IFX_OVERDRIVE_H_ */
@@ -0,0 +1,45 @@
+/*
+ * IFX_ParamSmoother.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef INC_IFX_PARAMSMOOTHER_H_
+#define INC_IFX_PARAMSMOOTHER_H_
+
+#include <stdint.h>
+
+typedef enum {
+	// Reach the target in a fixed number of blocks
+	IFX_SMOOTH_LINEAR = 0,
+	// One-pole approach to the target, time constant given in blocks
+	IFX_SMOOTH_EXPONENTIAL
+} IFX_SmoothMode;
+
+typedef struct {
+	IFX_SmoothMode mode;
+
+	// Target written by the control side
+	volatile float target;
+
+	// Value reached at the end of the last block
+	float current;
+
+	// Linear mode: ramp length, step per block and blocks left
+	uint32_t rampBlocks;
+	float step;
+	uint32_t blocksLeft;
+	float rampTarget;
+
+	// Exponential mode: fraction of the remaining distance covered per block
+	float expCoef;
+} IFX_ParamSmoother;
+
+void IFX_ParamSmoother_Init(IFX_ParamSmoother *sm, float initialValue, IFX_SmoothMode mode, uint32_t blocks);
+void IFX_ParamSmoother_SetBlocks(IFX_ParamSmoother *sm, uint32_t blocks);
+void IFX_ParamSmoother_SetTarget(IFX_ParamSmoother *sm, float value);
+float IFX_ParamSmoother_Step(IFX_ParamSmoother *sm, float *start);
+void IFX_ApplyGainRamp(const float *in, float *out, uint32_t n, float gainStart, float gainEnd);
+void IFX_MixGainRamp(const float *in, float *out, uint32_t n, float gainStart, float gainEnd);
+
+#endif /* INC_IFX_PARAMSMOOTHER_H_ */
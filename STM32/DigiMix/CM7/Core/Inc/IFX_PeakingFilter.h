@@ -21,10 +21,15 @@ typedef struct {
 	// y[n] coefficients
 	float b[3];
 
+	// Normalised coefficients for the block path (a[0..2] * b[0], b[1..2] * b[0])
+	float k[5];
+
 } IFX_PeakingFilter;
 
 void IFX_PeakingFilter_Init(IFX_PeakingFilter *filt, float sampleRate_Hz);
 void IFX_PeakingFilter_SetParameters(IFX_PeakingFilter *filt, float centerFrequency_Hz, float bandwidth_Hz, float boostCut_linear);
 float IFX_PeakingFilter_Update(IFX_PeakingFilter *filt, float in);
+void IFX_PeakingFilter_ProcessBlock(IFX_PeakingFilter *filt, const float *in, float *out, uint32_t n);
+void IFX_PeakingFilter_Design(float *coef, float sampleTime_s, float centerFrequency_Hz, float Q, float boostCut_linear);
 
 #endif
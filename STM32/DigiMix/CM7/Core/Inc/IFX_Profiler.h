@@ -0,0 +1,71 @@
+/*
+ * IFX_Profiler.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef INC_IFX_PROFILER_H_
+#define INC_IFX_PROFILER_H_
+
+#include <stdint.h>
+
+// Stages that can be timed inside one block
+#define IFX_PROFILER_MAX_STAGES 8
+
+// Block time histogram: IFX_PROFILER_HIST_BINS - 1 bins of 10 % of the block budget each, the last
+// bin collects every block that used the whole budget or more
+#define IFX_PROFILER_HIST_BINS 11
+
+typedef struct {
+	uint32_t min;
+	uint32_t max;
+	uint64_t total;
+	uint32_t count;
+} IFX_ProfilerStat;
+
+typedef struct {
+	// Cycles available per block (one DMA half-transfer period)
+	uint32_t budget;
+
+	// Whole block, then each stage, in IFX_Cycles units
+	IFX_ProfilerStat block;
+	IFX_ProfilerStat stage[IFX_PROFILER_MAX_STAGES];
+	const char *stageName[IFX_PROFILER_MAX_STAGES];
+	uint32_t numStages;
+
+	// Blocks still running when the next half-transfer interrupt arrived
+	uint32_t xruns;
+	uint32_t hist[IFX_PROFILER_HIST_BINS];
+
+	// DMA half-transfer interrupts seen / blocks finished, to detect xruns
+	volatile uint32_t dmaEvents;
+	uint32_t blocksDone;
+
+	// Set by the control side, the audio side clears the statistics at its next block
+	volatile uint8_t resetRequest;
+
+	// Time stamps of the block being measured
+	uint32_t blockStart;
+	uint32_t mark;
+} IFX_Profiler;
+
+void IFX_Profiler_Init(IFX_Profiler *prof, uint32_t budget);
+uint32_t IFX_Profiler_AddStage(IFX_Profiler *prof, const char *name);
+void IFX_Profiler_Reset(IFX_Profiler *prof);
+void IFX_Profiler_SetBudget(IFX_Profiler *prof, uint32_t budget);
+
+// Audio side, in this order for each block
+void IFX_Profiler_BlockBegin(IFX_Profiler *prof);
+void IFX_Profiler_StageEnd(IFX_Profiler *prof, uint32_t stage);
+void IFX_Profiler_BlockEnd(IFX_Profiler *prof);
+
+// Same as BlockEnd, with the block time given instead of measured (host tests, replay)
+void IFX_Profiler_AddBlock(IFX_Profiler *prof, uint32_t elapsed);
+
+// Interrupt side, from the DMA half / full transfer callbacks
+void IFX_Profiler_DmaEvent(IFX_Profiler *prof);
+
+// Average of a stat, 0 if nothing was recorded
+uint32_t IFX_Profiler_Average(const IFX_ProfilerStat *stat);
+
+#endif /* INC_IFX_PROFILER_H_ */
@@ -0,0 +1,36 @@
+/*
+ * IFX_SampleConvert.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef INC_IFX_SAMPLECONVERT_H_
+#define INC_IFX_SAMPLECONVERT_H_
+
+#include <stdint.h>
+
+// Strides are in 16-bit words, so one channel can be picked out of an interleaved I2S buffer.
+// Output saturates to the 16-bit range instead of wrapping.
+void IFX_Int16ToFloat(const int16_t *in, uint32_t inStride, float *out, uint32_t n);
+void IFX_FloatToInt16(const float *in, int16_t *out, uint32_t outStride, uint32_t n);
+
+// Packed 16-bit pairs, one per 32-bit word: left in bits 15..0, right in bits 31..16 (the memory
+// layout of interleaved int16 L/R on a little-endian core). One 32-bit load or store per pair; on
+// the M7 packing is SSAT + PKHBT, unpacking SXTH + ASR. The float side stride is in floats: 1 for
+// separate left/right buffers, 2 with right = left + 1 for two consecutive samples of one stream.
+void IFX_Int16StereoToFloat(const int32_t *in, float *left, float *right, uint32_t outStride, uint32_t n);
+void IFX_FloatToInt16Stereo(const float *left, const float *right, uint32_t inStride, int32_t *out, uint32_t n);
+
+// 24-bit samples in 32-bit I2S slots, left aligned (sample in bits 31..8, bits 7..0 zero), so the
+// slot read as int32_t is the sample scaled by 2^8. Strides are in 32-bit slots.
+// Output saturates to the 24-bit range instead of wrapping.
+void IFX_Int24ToFloat(const int32_t *in, uint32_t inStride, float *out, uint32_t n);
+void IFX_FloatToInt24(const float *in, int32_t *out, uint32_t outStride, uint32_t n);
+
+// Same format, numCh slots per frame (TDM): one pass over the interleaved buffer to or from one
+// planar buffer per channel. Works four frames at a time so the DMA buffer is read or written in
+// short sequential runs.
+void IFX_Int24ToFloatPlanar(const int32_t *in, uint32_t numCh, float *const *out, uint32_t n);
+void IFX_FloatPlanarToInt24(const float *const *in, uint32_t numCh, int32_t *out, uint32_t n);
+
+#endif /* INC_IFX_SAMPLECONVERT_H_ */
@@ -0,0 +1,50 @@
+/*
+ * SAI_TDM.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef INC_SAI_TDM_H_
+#define INC_SAI_TDM_H_
+
+#include "stm32h7xx_hal.h"
+
+// SAI1 as a TDM link to a multichannel codec: block A is the master transmitter (MCLK, SCK, FS,
+// SD out), block B a receiver synchronous to it. Each frame is SAI_TDM_SLOTS 32-bit slots holding
+// 24-bit left-aligned samples, the same slot format as the I2S links, so IFX_Int24ToFloatPlanar
+// and IFX_FloatPlanarToInt24 work on the DMA buffers directly.
+//
+// Written against the registers: the HAL SAI driver is not part of this tree, only HAL DMA is used.
+//
+// Pins (AF6): PE2 MCLK_A, PE4 FS_A, PE5 SCK_A, PE6 SD_A (out), PE3 SD_B (in)
+
+// Slots per frame. MCLK is 256 fs and the frame length must be a power of two, so 2, 4 or 8.
+#define SAI_TDM_SLOTS 8
+
+#if (SAI_TDM_SLOTS != 2) && (SAI_TDM_SLOTS != 4) && (SAI_TDM_SLOTS != 8)
+#error "SAI_TDM_SLOTS must be 2, 4 or 8"
+#endif
+
+// Same NVIC priority as the I2S streams (must stay at or below configMAX_SYSCALL_INTERRUPT_PRIORITY)
+#define SAI_TDM_IRQ_PRIORITY 5
+
+// DMA1_Stream3 (block A, transmit) and DMA1_Stream6 (block B, receive). Only the receive stream
+// interrupts; DMA1_Stream6_IRQHandler must call HAL_DMA_IRQHandler(&hdma_sai1_b).
+extern DMA_HandleTypeDef hdma_sai1_a;
+extern DMA_HandleTypeDef hdma_sai1_b;
+
+HAL_StatusTypeDef SAI_TDM_Init(uint32_t sampleRate_Hz);
+
+// txBuf and rxBuf hold two halves of frames * SAI_TDM_SLOTS words each, in a DMA-reachable RAM
+HAL_StatusTypeDef SAI_TDM_Start(int32_t *txBuf, int32_t *rxBuf, uint32_t frames);
+HAL_StatusTypeDef SAI_TDM_Stop(void);
+
+// FIFO overruns/underruns and DMA errors since SAI_TDM_Init
+uint32_t SAI_TDM_GetErrors(void);
+
+// Called from the receive DMA interrupt once half 0 or 1 of rxBuf is full. The transmit DMA has
+// moved on to the other half by then, so the same half of txBuf can be refilled. Weak, override in
+// the application.
+void SAI_TDM_HalfCpltCallback(uint8_t half);
+
+#endif /* INC_SAI_TDM_H_ */
@@ -0,0 +1,63 @@
+/*
+ * UART_Frame.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef INC_UART_FRAME_H_
+#define INC_UART_FRAME_H_
+
+#include <stdint.h>
+
+// Streaming framer for the control link. Bytes are fed as the receive DMA delivers them, in chunks
+// of any size, and come out as one of two kinds of frame:
+//  - text: a '\n' terminated ASCII line, handed to onLine NUL terminated with the '\r' and any
+//    trailing space padding removed. Empty lines are skipped.
+//  - packet: the bytes between a 0x00 and the next 0x00 (a COBS frame, see CTRL_Link.h), handed to
+//    onPacket still encoded. Back-to-back delimiters are skipped.
+// Neither kind contains a 0x00 otherwise, so a 0x00 always starts a packet, dropping any partial line.
+//
+// A frame longer than its limit is dropped up to its terminator and counted, and a receive error
+// drops the frame it happened in (UART_Frame_Discard), so a lost or corrupted byte costs one
+// command, not the framing of every later one. Plain C, no HAL: runs in the UART interrupt or on a PC.
+
+// Longest command line, without the terminator
+#define UART_FRAME_MAX 64
+
+// Longest packet, without the delimiters
+#define UART_FRAME_PACKET_MAX 160
+
+typedef void (*UART_LineHandler)(const char *text, uint32_t len);
+typedef void (*UART_PacketHandler)(const uint8_t *data, uint32_t len);
+
+typedef struct {
+
+	uint8_t data[UART_FRAME_PACKET_MAX + 1];
+	uint32_t len;
+
+	// Inside a packet (after its opening 0x00)
+	uint8_t packet;
+
+	// Skipping to the end of the current frame (too long or receive error)
+	uint8_t discard;
+
+	// Frames dropped for being too long
+	uint32_t overflows;
+
+	UART_LineHandler onLine;
+	UART_PacketHandler onPacket;
+
+} UART_Frame;
+
+void UART_Frame_Init(UART_Frame *fr, UART_LineHandler onLine, UART_PacketHandler onPacket);
+
+// Drop the frame in progress, up to and including its terminator
+void UART_Frame_Discard(UART_Frame *fr);
+
+// Forget the frame in progress without waiting for its terminator: the next byte starts a new
+// frame. For a restarted reception (baud rate change), where the old frame will never end.
+void UART_Frame_Reset(UART_Frame *fr);
+
+void UART_Frame_Feed(UART_Frame *fr, const uint8_t *data, uint32_t n);
+
+#endif /* INC_UART_FRAME_H_ */
@@ -0,0 +1,290 @@
+/*
+ * IFX_Bench.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#if !defined(CORE_CM7) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L		// clock_gettime for the host backend
+#endif
+
+#include "IFX_Bench.h"
+#include "IFX_Cycles.h"
+#include "IFX_PeakingFilter.h"
+#include "IFX_BiquadCascade.h"
+#include "IFX_Overdrive.h"
+#include "IFX_FIR.h"
+#include "IFX_ParamSmoother.h"
+#include "IFX_SampleConvert.h"
+#include "IFX_CoefDesign.h"
+
+#include <math.h>
+
+typedef void (*IFX_BenchKernel)(void);
+
+// Slots per frame for the TDM conversion kernels
+#define IFX_BENCH_TDM_SLOTS 8
+
+// Working buffers, shared by all kernels
+static float benchIn[IFX_BENCH_BLOCK_SIZE];
+static float benchOut[IFX_BENCH_BLOCK_SIZE];
+static float benchOut2[IFX_BENCH_BLOCK_SIZE];
+static int16_t benchI2S[IFX_BENCH_BLOCK_SIZE * 4];
+static int32_t benchI2S32[IFX_BENCH_BLOCK_SIZE * 2];
+static int32_t benchTdm[IFX_BENCH_BLOCK_SIZE * IFX_BENCH_TDM_SLOTS];
+static float benchPlanes[IFX_BENCH_TDM_SLOTS][IFX_BENCH_BLOCK_SIZE];
+static float *const benchPlanePtr[IFX_BENCH_TDM_SLOTS] = {
+	benchPlanes[0], benchPlanes[1], benchPlanes[2], benchPlanes[3],
+	benchPlanes[4], benchPlanes[5], benchPlanes[6], benchPlanes[7],
+};
+
+static IFX_PeakingFilter benchFilt;
+static IFX_BiquadCascade benchCasc;
+static IFX_Overdrive benchOd;
+static IFX_Overdrive benchOd2x;
+static IFX_Overdrive benchOd4x;
+static IFX_FIR benchFir;
+
+static volatile float benchSink;
+
+static void IFX_Bench_BiquadSample(void) {
+	for (uint32_t i = 0; i < IFX_BENCH_BLOCK_SIZE; i++) {
+		benchOut[i] = IFX_PeakingFilter_Update(&benchFilt, benchIn[i]);
+	}
+}
+
+static void IFX_Bench_BiquadBlock(void) {
+	IFX_PeakingFilter_ProcessBlock(&benchFilt, benchIn, benchOut, IFX_BENCH_BLOCK_SIZE);
+}
+
+static void IFX_Bench_Cascade(void) {
+	IFX_BiquadCascade_ProcessBlock(&benchCasc, benchIn, benchOut, IFX_BENCH_BLOCK_SIZE);
+}
+
+static void IFX_Bench_Overdrive(void) {
+	IFX_Overdrive_ProcessBlock(&benchOd, benchIn, benchOut, IFX_BENCH_BLOCK_SIZE);
+}
+
+static void IFX_Bench_Overdrive2x(void) {
+	IFX_Overdrive_ProcessBlock(&benchOd2x, benchIn, benchOut, IFX_BENCH_BLOCK_SIZE);
+}
+
+static void IFX_Bench_Overdrive4x(void) {
+	IFX_Overdrive_ProcessBlock(&benchOd4x, benchIn, benchOut, IFX_BENCH_BLOCK_SIZE);
+}
+
+static void IFX_Bench_Fir(void) {
+	IFX_FIR_ProcessBlock(&benchFir, benchIn, benchOut, IFX_BENCH_BLOCK_SIZE);
+}
+
+static void IFX_Bench_Int16ToFloat(void) {
+	IFX_Int16ToFloat(benchI2S, 4, benchOut, IFX_BENCH_BLOCK_SIZE);
+}
+
+static void IFX_Bench_FloatToInt16(void) {
+	IFX_FloatToInt16(benchIn, benchI2S, 4, IFX_BENCH_BLOCK_SIZE);
+}
+
+// Mono stream packed two samples per word, as the UART tap does
+static void IFX_Bench_FloatToInt16Packed(void) {
+	IFX_FloatToInt16Stereo(benchIn, benchIn + 1, 2, benchI2S32, IFX_BENCH_BLOCK_SIZE / 2);
+}
+
+// Stereo kernels: one item is one frame
+static void IFX_Bench_Int16StereoToFloat(void) {
+	IFX_Int16StereoToFloat(benchI2S32, benchOut, benchOut2, 1, IFX_BENCH_BLOCK_SIZE);
+}
+
+static void IFX_Bench_FloatToInt16Stereo(void) {
+	IFX_FloatToInt16Stereo(benchIn, benchIn, 1, benchI2S32, IFX_BENCH_BLOCK_SIZE);
+}
+
+// Baseline for the packed store: the same frames as two strided passes
+static void IFX_Bench_FloatToInt16Pair(void) {
+	IFX_FloatToInt16(benchIn, benchI2S, 2, IFX_BENCH_BLOCK_SIZE);
+	IFX_FloatToInt16(benchIn, benchI2S + 1, 2, IFX_BENCH_BLOCK_SIZE);
+}
+
+static void IFX_Bench_Int24ToFloat(void) {
+	IFX_Int24ToFloat(benchI2S32, 2, benchOut, IFX_BENCH_BLOCK_SIZE);
+}
+
+static void IFX_Bench_FloatToInt24(void) {
+	IFX_FloatToInt24(benchIn, benchI2S32, 2, IFX_BENCH_BLOCK_SIZE);
+}
+
+// TDM kernels: one item is one frame (IFX_BENCH_TDM_SLOTS samples)
+static void IFX_Bench_TdmToPlanar(void) {
+	IFX_Int24ToFloatPlanar(benchTdm, IFX_BENCH_TDM_SLOTS, benchPlanePtr, IFX_BENCH_BLOCK_SIZE);
+}
+
+static void IFX_Bench_PlanarToTdm(void) {
+	IFX_FloatPlanarToInt24((const float *const *) benchPlanePtr, IFX_BENCH_TDM_SLOTS, benchTdm, IFX_BENCH_BLOCK_SIZE);
+}
+
+static void IFX_Bench_GainRamp(void) {
+	IFX_ApplyGainRamp(benchIn, benchOut, IFX_BENCH_BLOCK_SIZE, 0.5f, 0.25f);
+}
+
+// Control path: one peaking band redesign per item
+static void IFX_Bench_Design(void) {
+	float coef[IFX_BIQUADCASCADE_COEFS];
+
+	for (uint32_t i = 0; i < IFX_BENCH_BLOCK_SIZE; i++) {
+		float gain = IFX_DbToLinear(-20.0f + (float) i);
+		IFX_PeakingFilter_Design(coef, 1.0f / 48000.0f, 100.0f + 400.0f * (float) i, 1.0f, gain);
+		benchSink = coef[0];
+	}
+}
+
+// Per call cost of the fast design helpers next to the libm calls they replace. The arguments
+// cover the pre-warp range (up to 0.43 fs) and -20..+27 dB.
+static void IFX_Bench_TanPi(void) {
+	for (uint32_t i = 0; i < IFX_BENCH_BLOCK_SIZE; i++) {
+		benchSink = IFX_TanPi(0.001f + 0.009f * (float) i);
+	}
+}
+
+static void IFX_Bench_TanfLibm(void) {
+	for (uint32_t i = 0; i < IFX_BENCH_BLOCK_SIZE; i++) {
+		benchSink = tanf(IFX_PI * (0.001f + 0.009f * (float) i));
+	}
+}
+
+static void IFX_Bench_DbToLinear(void) {
+	for (uint32_t i = 0; i < IFX_BENCH_BLOCK_SIZE; i++) {
+		benchSink = IFX_DbToLinear(-20.0f + (float) i);
+	}
+}
+
+static void IFX_Bench_PowfLibm(void) {
+	for (uint32_t i = 0; i < IFX_BENCH_BLOCK_SIZE; i++) {
+		benchSink = powf(10.0f, (-20.0f + (float) i) * 0.05f);
+	}
+}
+
+static void IFX_Bench_Setup(void) {
+
+	uint32_t seed = 12345;
+
+	for (uint32_t i = 0; i < IFX_BENCH_BLOCK_SIZE; i++) {
+		seed = seed * 1664525u + 1013904223u;
+		benchIn[i] = ((float) (seed >> 8) / 16777216.0f - 0.5f) * 0.5f;
+	}
+	for (uint32_t i = 0; i < IFX_BENCH_BLOCK_SIZE * 4; i++) {
+		benchI2S[i] = (int16_t) (i * 97);
+	}
+	for (uint32_t i = 0; i < IFX_BENCH_BLOCK_SIZE * 2; i++) {
+		benchI2S32[i] = (int32_t) (i * 9973u) << 8;
+	}
+	for (uint32_t i = 0; i < IFX_BENCH_BLOCK_SIZE * IFX_BENCH_TDM_SLOTS; i++) {
+		benchTdm[i] = (int32_t) (i * 9973u) << 8;
+	}
+	for (uint32_t ch = 0; ch < IFX_BENCH_TDM_SLOTS; ch++) {
+		for (uint32_t i = 0; i < IFX_BENCH_BLOCK_SIZE; i++) {
+			benchPlanes[ch][i] = benchIn[(i + ch) % IFX_BENCH_BLOCK_SIZE];
+		}
+	}
+
+	IFX_PeakingFilter_Init(&benchFilt, 48000.0f);
+	IFX_PeakingFilter_SetParameters(&benchFilt, 1000.0f, 1.0f, 2.0f);
+
+	IFX_BiquadCascade_Init(&benchCasc, 48000.0f, IFX_BIQUADCASCADE_MAX_STAGES);
+	for (uint32_t n = 0; n < IFX_BIQUADCASCADE_MAX_STAGES; n++) {
+		IFX_BiquadCascade_SetPeaking(&benchCasc, n, 100.0f * (float) (n + 1) * (float) (n + 1), 1.0f, 1.5f);
+	}
+
+	IFX_Overdrive_Init(&benchOd, 48000.0f, 100.0f, 10.0f, 5000.0f, 0.7f);
+	IFX_Overdrive_Init(&benchOd2x, 48000.0f, 100.0f, 10.0f, 5000.0f, 0.7f);
+	IFX_Overdrive_SetOversampling(&benchOd2x, 2);
+	IFX_Overdrive_Init(&benchOd4x, 48000.0f, 100.0f, 10.0f, 5000.0f, 0.7f);
+	IFX_Overdrive_SetOversampling(&benchOd4x, 4);
+
+	// Overdrive anti-aliasing filter on its own (designed by IFX_Overdrive_Init above)
+	IFX_FIR_Init(&benchFir, IFX_OD_LPF_INP_COEF, IFX_OVERDRIVE_LPF_INP_LENGTH);
+}
+
+// Time one kernel: fastest of IFX_BENCH_RUNS runs of IFX_BENCH_BLOCKS blocks
+static void IFX_Bench_Time(IFX_BenchResult *res, const char *name, IFX_BenchKernel kernel, uint8_t perSample, float sampleRate_Hz) {
+
+	uint32_t best = 0xFFFFFFFFu;
+
+	// Warm caches and filter state
+	kernel();
+
+	for (uint32_t run = 0; run < IFX_BENCH_RUNS; run++) {
+		uint32_t start = IFX_Cycles_Now();
+
+		for (uint32_t b = 0; b < IFX_BENCH_BLOCKS; b++) {
+			kernel();
+		}
+
+		uint32_t elapsed = IFX_Cycles_Since(start);
+		if (elapsed < best) {
+			best = elapsed;
+		}
+	}
+
+	float items = (float) (IFX_BENCH_BLOCKS * IFX_BENCH_BLOCK_SIZE);
+
+	res->name = name;
+	res->cyclesPerItem = (float) best / items;
+	res->nsPerItem = res->cyclesPerItem * (1.0e9f / IFX_CYCLES_PER_SECOND);
+	res->perSample = perSample;
+
+	if (perSample) {
+		float budgetNs = 1.0e9f / sampleRate_Hz;
+		res->headroomPct = 100.0f * (1.0f - res->nsPerItem / budgetNs);
+	} else {
+		res->headroomPct = 0.0f;
+	}
+}
+
+// Run every kernel and fill results (at most maxResults). Returns the number of results.
+// Control-rate only: takes a few milliseconds and must not run in the audio path.
+uint32_t IFX_Bench_RunAll(IFX_BenchResult *results, uint32_t maxResults, float sampleRate_Hz) {
+
+	static const struct {
+		const char *name;
+		IFX_BenchKernel kernel;
+		uint8_t perSample;
+	} kernels[] = {
+		{ "biquad/sample",  IFX_Bench_BiquadSample, 1 },
+		{ "biquad/block",   IFX_Bench_BiquadBlock,  1 },
+		{ "cascade x5",     IFX_Bench_Cascade,      1 },
+		{ "overdrive",      IFX_Bench_Overdrive,    1 },
+		{ "overdrive 2x",   IFX_Bench_Overdrive2x,  1 },
+		{ "overdrive 4x",   IFX_Bench_Overdrive4x,  1 },
+		{ "fir 69",         IFX_Bench_Fir,          1 },
+		{ "int16->float",   IFX_Bench_Int16ToFloat, 1 },
+		{ "float->int16",   IFX_Bench_FloatToInt16, 1 },
+		{ "float->i16 pk",  IFX_Bench_FloatToInt16Packed, 1 },
+		{ "i16 st->float",  IFX_Bench_Int16StereoToFloat, 1 },
+		{ "float->i16 st",  IFX_Bench_FloatToInt16Stereo, 1 },
+		{ "float->i16 2x",  IFX_Bench_FloatToInt16Pair,   1 },
+		{ "int24->float",   IFX_Bench_Int24ToFloat, 1 },
+		{ "float->int24",   IFX_Bench_FloatToInt24, 1 },
+		{ "tdm8->planar",   IFX_Bench_TdmToPlanar,  1 },
+		{ "planar->tdm8",   IFX_Bench_PlanarToTdm,  1 },
+		{ "gain ramp",      IFX_Bench_GainRamp,     1 },
+		{ "design/band",    IFX_Bench_Design,       0 },
+		{ "tanpi",          IFX_Bench_TanPi,        0 },
+		{ "tanf (libm)",    IFX_Bench_TanfLibm,     0 },
+		{ "db->linear",     IFX_Bench_DbToLinear,   0 },
+		{ "powf (libm)",    IFX_Bench_PowfLibm,     0 },
+	};
+
+	uint32_t count = sizeof(kernels) / sizeof(kernels[0]);
+	if (count > maxResults) {
+		count = maxResults;
+	}
+
+	IFX_Cycles_Init();
+	IFX_Bench_Setup();
+
+	for (uint32_t k = 0; k < count; k++) {
+		IFX_Bench_Time(&results[k], kernels[k].name, kernels[k].kernel, kernels[k].perSample, sampleRate_Hz);
+	}
+
+	return count;
+}
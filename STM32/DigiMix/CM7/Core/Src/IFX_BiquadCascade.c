@@ -0,0 +1,185 @@
+/*
+ * IFX_BiquadCascade.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#include "IFX_BiquadCascade.h"
+#include "IFX_FastMem.h"
+
+void IFX_BiquadCascade_Init(IFX_BiquadCascade *casc, float sampleRate_Hz, uint32_t numStages) {
+
+	// Sample time
+	casc->sampleTime_s = 1.0f / sampleRate_Hz;
+
+	if (numStages > IFX_BIQUADCASCADE_MAX_STAGES) {
+		numStages = IFX_BIQUADCASCADE_MAX_STAGES;
+	}
+	casc->numStages = numStages;
+
+	// Every stage starts as a pass-through
+	for (uint32_t bank = 0; bank < IFX_BIQUADCASCADE_BANKS; bank++) {
+		for (uint32_t n = 0; n < IFX_BIQUADCASCADE_MAX_STAGES; n++) {
+			float *c = &casc->coef[bank][n * IFX_BIQUADCASCADE_COEFS];
+
+			c[0] = 1.0f;
+			c[1] = 0.0f;
+			c[2] = 0.0f;
+			c[3] = 0.0f;
+			c[4] = 0.0f;
+		}
+	}
+
+	for (uint32_t n = 0; n < IFX_BIQUADCASCADE_MAX_STAGES * IFX_BIQUADCASCADE_STATES; n++) {
+		casc->state[n] = 0.0f;
+	}
+
+	for (uint32_t n = 0; n < IFX_BIQUADCASCADE_MAX_STAGES * IFX_BIQUADCASCADE_COEFS; n++) {
+		casc->coefRun[n] = casc->coef[0][n];
+		casc->coefStep[n] = 0.0f;
+	}
+
+	atomic_init(&casc->published, 0);
+	atomic_init(&casc->active, 0);
+
+	// No smoothing until configured
+	casc->smoothBlocks = 1;
+	casc->blocksLeft = 0;
+	casc->runBank = 0;
+}
+
+// Number of blocks a new coefficient set is interpolated over (1 = switch at the next block).
+// Configure before audio starts.
+void IFX_BiquadCascade_SetSmoothing(IFX_BiquadCascade *casc, uint32_t blocks) {
+
+	casc->smoothBlocks = (blocks == 0) ? 1 : blocks;
+}
+
+// Control side. Builds the new set in a bank the audio path is neither using nor about to latch,
+// then publishes it with a single atomic store. Must only be called from one context (the control
+// path), never from the audio path.
+void IFX_BiquadCascade_SetPeaking(IFX_BiquadCascade *casc, uint32_t stage, float centerFrequency_Hz, float Q, float boostCut_linear) {
+
+	if (stage >= casc->numStages) {
+		return;
+	}
+
+	uint32_t pub = atomic_load_explicit(&casc->published, memory_order_relaxed);
+	uint32_t act = atomic_load_explicit(&casc->active, memory_order_seq_cst);
+
+	uint32_t next = 0;
+	while (next == pub || next == act) {
+		next++;
+	}
+
+	// Start from the published set so the other stages are kept
+	float *dst = casc->coef[next];
+	const float *src = casc->coef[pub];
+	for (uint32_t n = 0; n < IFX_BIQUADCASCADE_MAX_STAGES * IFX_BIQUADCASCADE_COEFS; n++) {
+		dst[n] = src[n];
+	}
+
+	IFX_PeakingFilter_Design(&dst[stage * IFX_BIQUADCASCADE_COEFS], casc->sampleTime_s, centerFrequency_Hz, Q, boostCut_linear);
+
+	atomic_store_explicit(&casc->published, next, memory_order_seq_cst);
+}
+
+// Audio side, once per block. Latch the published bank; re-check in case the control side
+// published again between the load and the store, so it can never pick the bank we latch.
+DSP_FAST_CODE static uint32_t IFX_BiquadCascade_Latch(IFX_BiquadCascade *casc) {
+
+	uint32_t idx;
+
+	do {
+		idx = atomic_load_explicit(&casc->published, memory_order_acquire);
+		atomic_store_explicit(&casc->active, idx, memory_order_seq_cst);
+	} while (atomic_load_explicit(&casc->published, memory_order_acquire) != idx);
+
+	return idx;
+}
+
+// Audio side, once per block. Move the running coefficients one block closer to the latched bank.
+DSP_FAST_CODE static const float *IFX_BiquadCascade_Smooth(IFX_BiquadCascade *casc) {
+
+	uint32_t idx = IFX_BiquadCascade_Latch(casc);
+	const float *target = casc->coef[idx];
+	float *run = casc->coefRun;
+	float *step = casc->coefStep;
+	const uint32_t count = casc->numStages * IFX_BIQUADCASCADE_COEFS;
+
+	// New set published: start a ramp from wherever we are now
+	if (idx != casc->runBank) {
+		float scale = 1.0f / (float) casc->smoothBlocks;
+
+		for (uint32_t n = 0; n < count; n++) {
+			step[n] = (target[n] - run[n]) * scale;
+		}
+
+		casc->runBank = idx;
+		casc->blocksLeft = casc->smoothBlocks;
+	}
+
+	if (casc->blocksLeft > 0) {
+		casc->blocksLeft--;
+
+		if (casc->blocksLeft == 0) {
+			// Land exactly on the published set
+			for (uint32_t n = 0; n < count; n++) {
+				run[n] = target[n];
+			}
+		} else {
+			for (uint32_t n = 0; n < count; n++) {
+				run[n] += step[n];
+			}
+		}
+	}
+
+	return run;
+}
+
+// Run a block through every stage (in and out may alias). Each stage sweeps the whole block
+// with its coefficients and state in registers before the next stage starts.
+DSP_FAST_CODE void IFX_BiquadCascade_ProcessBlock(IFX_BiquadCascade *casc, const float *in, float *out, uint32_t n) {
+
+	const float *c = IFX_BiquadCascade_Smooth(casc);
+	float *st = casc->state;
+	const float *src = in;
+
+	for (uint32_t stage = 0; stage < casc->numStages; stage++) {
+		const float b0 = c[0];
+		const float b1 = c[1];
+		const float b2 = c[2];
+		const float a1 = c[3];
+		const float a2 = c[4];
+
+		float s1 = st[0];
+		float s2 = st[1];
+
+		for (uint32_t i = 0; i < n; i++) {
+			float x = src[i];
+			float y = b0 * x + s1;
+
+			s1 = b1 * x + a1 * y + s2;
+			s2 = b2 * x + a2 * y;
+
+			out[i] = y;
+		}
+
+		st[0] = s1;
+		st[1] = s2;
+
+		c += IFX_BIQUADCASCADE_COEFS;
+		st += IFX_BIQUADCASCADE_STATES;
+
+		// Later stages work in place on the output buffer
+		src = out;
+	}
+
+	// No stages: plain copy
+	if (casc->numStages == 0 && in != out) {
+		for (uint32_t i = 0; i < n; i++) {
+			out[i] = in[i];
+		}
+	}
+}
@@ -0,0 +1,84 @@
+/*
+ * IFX_CoefDesign.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#include "IFX_CoefDesign.h"
+
+// log2(10) / 20
+#define IFX_DB_TO_LOG2 0.166096404744368f
+
+// Largest argument accepted by IFX_TanPi (just below Nyquist)
+#define IFX_TANPI_MAX_ARG 0.4999f
+
+// tan(y) for y in [0, pi/4], [5/4] Pade approximant
+static inline float IFX_TanPade(float y) {
+
+	float y2 = y * y;
+
+	return y * (945.0f + y2 * (-105.0f + y2)) / (945.0f + y2 * (-420.0f + 15.0f * y2));
+}
+
+// tan(pi * x) for x in [0, 0.5), e.g. x = f / fs for the bilinear pre-warp
+float IFX_TanPi(float x) {
+
+	if (x <= 0.0f) {
+		return 0.0f;
+	}
+
+	if (x > IFX_TANPI_MAX_ARG) {
+		x = IFX_TANPI_MAX_ARG;
+	}
+
+	// Above pi/4 use tan(pi * x) = 1 / tan(pi * (0.5 - x))
+	if (x > 0.25f) {
+		return 1.0f / IFX_TanPade(IFX_PI * (0.5f - x));
+	}
+
+	return IFX_TanPade(IFX_PI * x);
+}
+
+// 2^x: split into integer and [-0.5, 0.5] fraction, polynomial for the fraction and
+// the integer part written straight into the float exponent
+static float IFX_Exp2(float x) {
+
+	if (x < -126.0f) {
+		return 0.0f;
+	}
+	if (x > 127.0f) {
+		x = 127.0f;
+	}
+
+	int32_t n = (int32_t) (x + ((x >= 0.0f) ? 0.5f : -0.5f));
+	float f = (x - (float) n) * 0.693147180559945f;
+
+	// e^f, degree 6 Taylor on |f| <= ln(2) / 2
+	float p = 1.0f + f * (1.0f + f * (0.5f + f * (0.166666667f + f * (0.0416666667f + f * (0.00833333333f + f * 0.00138888889f)))));
+
+	union {
+		float f;
+		uint32_t u;
+	} scale;
+
+	scale.u = (uint32_t) (n + 127) << 23;
+
+	return p * scale.f;
+}
+
+// 10^(dB / 20)
+float IFX_DbToLinear(float dB) {
+	return IFX_Exp2(dB * IFX_DB_TO_LOG2);
+}
+
+// UI fader position (0..100) to gain, same curve as before: 10^(2 * (volume / 100 - 1)),
+// i.e. -40 dB at the bottom of the fader and 0 dB at the top
+float IFX_VolumeToLinear(uint8_t volume) {
+
+	if (volume > 100) {
+		volume = 100;
+	}
+
+	return IFX_DbToLinear(0.4f * (float) volume - 40.0f);
+}
@@ -0,0 +1,160 @@
+/*
+ * IFX_FIR.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#include <math.h>
+
+#include "IFX_FIR.h"
+#include "IFX_CoefDesign.h"
+#include "IFX_FastMem.h"
+
+void IFX_FIR_Init(IFX_FIR *fir, const float *coef, uint32_t numTaps) {
+
+	if (numTaps > IFX_FIR_MAX_TAPS) {
+		numTaps = IFX_FIR_MAX_TAPS;
+	}
+	if (numTaps == 0) {
+		numTaps = 1;
+	}
+
+	fir->coef = coef;
+	fir->numTaps = numTaps;
+
+	IFX_FIR_Reset(fir);
+}
+
+void IFX_FIR_Reset(IFX_FIR *fir) {
+
+	for (uint32_t n = 0; n < 2 * IFX_FIR_MAX_TAPS; n++) {
+		fir->state[n] = 0.0f;
+	}
+	fir->index = 0;
+}
+
+// Dot product over contiguous data, four independent accumulators so the FPU pipeline stays full
+DSP_FAST_CODE static inline float IFX_FIR_DotProduct(const float *h, const float *x, uint32_t numTaps) {
+
+	float acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+	uint32_t k = 0;
+
+	for (; k + 4 <= numTaps; k += 4) {
+		acc0 += h[k] * x[k];
+		acc1 += h[k + 1] * x[k + 1];
+		acc2 += h[k + 2] * x[k + 2];
+		acc3 += h[k + 3] * x[k + 3];
+	}
+	for (; k < numTaps; k++) {
+		acc0 += h[k] * x[k];
+	}
+
+	return (acc0 + acc1) + (acc2 + acc3);
+}
+
+DSP_FAST_CODE void IFX_FIR_Push(IFX_FIR *fir, float inp) {
+
+	uint32_t N = fir->numTaps;
+
+	// Step back one slot (newest input at the lowest address), a select rather than a loop branch
+	uint32_t index = ((fir->index == 0) ? N : fir->index) - 1;
+	fir->index = index;
+
+	fir->state[index] = inp;
+	fir->state[index + N] = inp;
+}
+
+// state[index + k] = x[n - k]
+DSP_FAST_CODE float IFX_FIR_Dot(const IFX_FIR *fir, const float *coef) {
+
+	return IFX_FIR_DotProduct(coef, &fir->state[fir->index], fir->numTaps);
+}
+
+DSP_FAST_CODE float IFX_FIR_Update(IFX_FIR *fir, float inp) {
+
+	IFX_FIR_Push(fir, inp);
+
+	return IFX_FIR_DotProduct(fir->coef, &fir->state[fir->index], fir->numTaps);
+}
+
+// Process a whole buffer (in and out may alias)
+DSP_FAST_CODE void IFX_FIR_ProcessBlock(IFX_FIR *fir, const float *in, float *out, uint32_t n) {
+
+	const float *h = fir->coef;
+	float *state = fir->state;
+	uint32_t N = fir->numTaps;
+	uint32_t index = fir->index;
+
+	for (uint32_t i = 0; i < n; i++) {
+		index = ((index == 0) ? N : index) - 1;
+
+		float x = in[i];
+		state[index] = x;
+		state[index + N] = x;
+
+		out[i] = IFX_FIR_DotProduct(h, &state[index], N);
+	}
+
+	fir->index = index;
+}
+
+// Zeroth order modified Bessel function of the first kind (power series), for the Kaiser window
+static double IFX_FIR_BesselI0(double x) {
+
+	double sum = 1.0;
+	double term = 1.0;
+	double halfX = 0.5 * x;
+
+	for (uint32_t k = 1; k < 32; k++) {
+		term *= (halfX / k) * (halfX / k);
+		sum += term;
+
+		if (term < 1.0e-12 * sum) {
+			break;
+		}
+	}
+
+	return sum;
+}
+
+void IFX_FIR_DesignLowpass(float *coef, uint32_t numTaps, float cutoff, float attenuation_dB) {
+
+	if (numTaps == 0) {
+		return;
+	}
+	if (numTaps == 1) {
+		coef[0] = 1.0f;
+		return;
+	}
+
+	// Kaiser's empirical beta for the requested stop-band attenuation
+	double beta;
+	if (attenuation_dB > 50.0f) {
+		beta = 0.1102 * (attenuation_dB - 8.7);
+	} else if (attenuation_dB > 21.0f) {
+		beta = 0.5842 * pow(attenuation_dB - 21.0, 0.4) + 0.07886 * (attenuation_dB - 21.0);
+	} else {
+		beta = 0.0;
+	}
+
+	const double M = numTaps - 1;
+	const double i0Beta = IFX_FIR_BesselI0(beta);
+	double sum = 0.0;
+
+	// First pass: un-normalised taps (in float) and their sum (in double)
+	for (uint32_t n = 0; n < numTaps; n++) {
+		double m = n - 0.5 * M;
+		double sinc = (m == 0.0) ? 2.0 * cutoff : sin(2.0 * IFX_PI * cutoff * m) / (IFX_PI * m);
+		double r = 2.0 * n / M - 1.0;
+		double h = sinc * IFX_FIR_BesselI0(beta * sqrt(1.0 - r * r)) / i0Beta;
+
+		coef[n] = (float) h;
+		sum += h;
+	}
+
+	float norm = (float) (1.0 / sum);
+	for (uint32_t n = 0; n < numTaps; n++) {
+		coef[n] *= norm;
+	}
+}
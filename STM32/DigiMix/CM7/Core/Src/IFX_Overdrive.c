@@ -7,13 +7,62 @@
 
 
 #include "IFX_Overdrive.h"
+#include "IFX_CoefDesign.h"
+#include "IFX_FastMem.h"
 
-float IFX_OD_LPF_INP_COEF[IFX_OVERDRIVE_LPF_INP_LENGTH] = {
+DSP_FAST_BSS float IFX_OD_LPF_INP_COEF[IFX_OVERDRIVE_LPF_INP_LENGTH];
 
-};
+static uint8_t IFX_OD_LPF_INP_READY = 0;
+
+// Oversampling filters, per factor: the decimator runs the prototype as is, the interpolator uses it
+// split into factor phases of IFX_OVERDRIVE_OS_PHASE_TAPS taps (phase p = factor * h[p + factor * k])
+DSP_FAST_BSS static float IFX_OD_OS2_DECIM_COEF[2 * IFX_OVERDRIVE_OS_PHASE_TAPS];
+DSP_FAST_BSS static float IFX_OD_OS2_INTERP_COEF[2 * IFX_OVERDRIVE_OS_PHASE_TAPS];
+DSP_FAST_BSS static float IFX_OD_OS4_DECIM_COEF[4 * IFX_OVERDRIVE_OS_PHASE_TAPS];
+DSP_FAST_BSS static float IFX_OD_OS4_INTERP_COEF[4 * IFX_OVERDRIVE_OS_PHASE_TAPS];
+
+static void IFX_Overdrive_DesignOversampling(float *decimCoef, float *interpCoef, uint32_t factor) {
+
+	const uint32_t P = IFX_OVERDRIVE_OS_PHASE_TAPS;
+
+	IFX_FIR_DesignLowpass(decimCoef, factor * P, IFX_OVERDRIVE_OS_CUTOFF / factor, IFX_OVERDRIVE_OS_ATTEN_DB);
+
+	for (uint32_t p = 0; p < factor; p++) {
+		for (uint32_t k = 0; k < P; k++) {
+			interpCoef[p * P + k] = factor * decimCoef[p + factor * k];
+		}
+	}
+}
+
+// Audio path: pick up a new oversampling factor between blocks, starting its filters from silence
+DSP_FAST_CODE static inline void IFX_Overdrive_LatchOversampling(IFX_Overdrive *od) {
+
+	uint8_t factor = od->osRequest;
+
+	if (factor == od->osFactor) {
+		return;
+	}
+	od->osFactor = factor;
+
+	if (factor == 4) {
+		IFX_FIR_Init(&od->osInterp, IFX_OD_OS4_INTERP_COEF, IFX_OVERDRIVE_OS_PHASE_TAPS);
+		IFX_FIR_Init(&od->osDecim, IFX_OD_OS4_DECIM_COEF, 4 * IFX_OVERDRIVE_OS_PHASE_TAPS);
+	} else if (factor == 2) {
+		IFX_FIR_Init(&od->osInterp, IFX_OD_OS2_INTERP_COEF, IFX_OVERDRIVE_OS_PHASE_TAPS);
+		IFX_FIR_Init(&od->osDecim, IFX_OD_OS2_DECIM_COEF, 2 * IFX_OVERDRIVE_OS_PHASE_TAPS);
+	}
+}
 
 void IFX_Overdrive_Init(IFX_Overdrive *od, float sampleRate_Hz, float hpfCutoffFrequencyHz, float odPreGain, float lpfCutoffFrequencyHz, float lpfDamping) {
 
+	// Shared anti-aliasing filter, designed by the first overdrive instance
+	if (!IFX_OD_LPF_INP_READY) {
+		IFX_FIR_DesignLowpass(IFX_OD_LPF_INP_COEF, IFX_OVERDRIVE_LPF_INP_LENGTH, IFX_OVERDRIVE_LPF_INP_CUTOFF, IFX_OVERDRIVE_LPF_INP_ATTEN_DB);
+		IFX_Overdrive_DesignOversampling(IFX_OD_OS2_DECIM_COEF, IFX_OD_OS2_INTERP_COEF, 2);
+		IFX_Overdrive_DesignOversampling(IFX_OD_OS4_DECIM_COEF, IFX_OD_OS4_INTERP_COEF, 4);
+		IFX_OD_LPF_INP_READY = 1;
+	}
+
 	// Sampling time
 	od->T = 1.0f / sampleRate_Hz;
 
@@ -24,71 +73,165 @@ void IFX_Overdrive_Init(IFX_Overdrive *od, float sampleRate_Hz, float hpfCutoffF
 	od->hpfInpBufOut[0] = 0.0f;
 	od->hpfInpBufOut[1] = 0.0f;
 
-	od->hpfInpWcT = 2.0f * M_PI * hpfCutoffFrequencyHz * od->T;
+	IFX_Overdrive_SetHPF(od, hpfCutoffFrequencyHz);
 
 	od->hpfInpOut = 0.0f;
 
 	// Input low-pass filter
-	for(uint8_t n = 0; n < IFX_OVERDRIVE_LPF_INP_LENGTH; n++) {
-		od->lpfInpBuf[n] = 0.0f;
-	}
-	od->lpfInpBufIndex = 0;
+	IFX_FIR_Init(&od->lpfInp, IFX_OD_LPF_INP_COEF, IFX_OVERDRIVE_LPF_INP_LENGTH);
 	od->lpfInpOut = 0.0f;
 
 	// Overdrive settings
 	od->preGain = odPreGain;
 	od->threshold = 1.0f / 3.0f;
 
+	// No oversampling until requested
+	IFX_FIR_Init(&od->osInterp, IFX_OD_OS2_INTERP_COEF, IFX_OVERDRIVE_OS_PHASE_TAPS);
+	IFX_FIR_Init(&od->osDecim, IFX_OD_OS2_DECIM_COEF, 2 * IFX_OVERDRIVE_OS_PHASE_TAPS);
+	od->osFactor = 1;
+	od->osRequest = 1;
+
 	// Output low-pass filter
-	od->lpfOutWcT = 2.0f * M_PI * lpfCutoffFrequencyHz * od->T;
-	od->lpfOutDamp = lpfDamping;
+	for(uint8_t n = 0; n < 3; n++) {
+		od->lpfOutBufIn[n] = 0.0f;
+		od->lpfOutBufOut[n] = 0.0f;
+	}
+	IFX_Overdrive_SetLPF(od, lpfCutoffFrequencyHz, lpfDamping);
+	od->lpfOutOut = 0.0f;
+
+	od->out = 0.0f;
 
 }
 
 void IFX_Overdrive_SetHPF(IFX_Overdrive *od, float hpfCutoffFrequencyHz) {
-	//od->hpfInpWcT = 2.0f * M_PI * hpfCu toffFrequencyHz * od->T;
+	od->hpfInpWcT = 2.0f * IFX_PI * hpfCutoffFrequencyHz * od->T;
+
+	// Divide once here instead of once per sample
+	float norm = 1.0f / (2.0f + od->hpfInpWcT);
+	od->hpfInpCoef[0] = 2.0f * norm;
+	od->hpfInpCoef[1] = (2.0f - od->hpfInpWcT) * norm;
 }
 
 void IFX_Overdrive_SetLPF(IFX_Overdrive *od, float lpfCutoffFrequencyHz, float lpfDamping) {
-	od->lpfOutWcT = 2.0f * M_PI * lpfCutoffFrequencyHz * od->T;
+	od->lpfOutWcT = 2.0f * IFX_PI * lpfCutoffFrequencyHz * od->T;
 	od->lpfOutDamp = lpfDamping;
+
+	float wcT = od->lpfOutWcT;
+	float wcT2 = wcT * wcT;
+	float norm = 1.0f / (4.0f + 4.0f * lpfDamping * wcT + wcT2);
+
+	od->lpfOutCoef[0] = wcT2 * norm;
+	od->lpfOutCoef[1] = -(2.0f * wcT2 - 8.0f) * norm;
+	od->lpfOutCoef[2] = -(4.0f - 4.0f * lpfDamping * wcT + wcT2) * norm;
 }
 
-float IFX_Overdrive_Update(IFX_Overdrive *od, float inp) {
-	// FIR low-pass anti-aliasing filter
-	od->lpfInpBuf[od->lpfInpBufIndex] = inp;
-	od->lpfInpBufIndex++;
+void IFX_Overdrive_SetPreGain(IFX_Overdrive *od, float odPreGain) {
+	od->preGain = odPreGain;
+}
 
-	if(od->lpfInpBufIndex == IFX_OVERDRIVE_LPF_INP_LENGTH) {
-		od->lpfInpBufIndex = 0;
+// Control side: 1, 2 or 4 (other values round down). Takes effect at the next block.
+void IFX_Overdrive_SetOversampling(IFX_Overdrive *od, uint8_t factor) {
+	if (factor >= 4) {
+		od->osRequest = 4;
+	} else if (factor >= 2) {
+		od->osRequest = 2;
+	} else {
+		od->osRequest = 1;
 	}
+}
 
-	od->lpfInpOut = 0.0f;
-	uint8_t index = od->lpfInpBufIndex;
+// Symmetrical soft clipping, quadratic knee between threshold and 2 * threshold
+DSP_FAST_CODE static inline float IFX_Overdrive_Clip(float clipIn, float threshold) {
 
-	for(uint8_t n = 0; n < IFX_OVERDRIVE_LPF_INP_LENGTH; n++) {
-		if(index == 0) {
-			index = IFX_OVERDRIVE_LPF_INP_LENGTH - 1;
-		} else {
-			index--;
-		}
+	float absClipIn = fabsf(clipIn);
+	float signClipIn = (clipIn >= 0.0f) ? 1.0f : -1.0f;
 
-		od->lpfInpOut += IFX_OD_LPF_INP_COEF[n] * od->lpfInpBuf[index];
+	if (absClipIn < threshold) {
+		return 2.0f * clipIn;
+	} else if (absClipIn < 2.0f * threshold) {
+		float knee = 2.0f - 3.0f * absClipIn;
+		return signClipIn * (3.0f - knee * knee) * (1.0f / 3.0f);
 	}
 
+	return signClipIn;
+}
+
+// Everything after the anti-aliasing FIR, one sample
+DSP_FAST_CODE static inline float IFX_Overdrive_Shape(IFX_Overdrive *od, float inp) {
+
+	od->lpfInpOut = inp;
+
 	// Variable first order IIR High-pass filter to remove some low frequency components, as these sound muddy when distorted
 	od->hpfInpBufIn[1] = od->hpfInpBufIn[0];
 	od->hpfInpBufIn[0] = od->lpfInpOut;
 
 	od->hpfInpBufOut[1] = od->hpfInpBufOut[0];
-	od->hpfInpBufOut[0] = (2.0f * (od->hpfInpBufIn[0] - od->hpfInpBufIn[1]) + (2.0f - od->hpfInpWcT) * od->hpfInpBufOut[0]);
+	od->hpfInpBufOut[0] = od->hpfInpCoef[0] * (od->hpfInpBufIn[0] - od->hpfInpBufIn[1]) + od->hpfInpCoef[1] * od->hpfInpBufOut[1];
+
+	od->hpfInpOut = od->hpfInpBufOut[0];
 
+	// Soft clipping, at osFactor times the sample rate when oversampling
+	float clipIn = od->preGain * od->hpfInpOut;
+	float clipOut;
 
+	if (od->osFactor == 1) {
+		clipOut = IFX_Overdrive_Clip(clipIn, od->threshold);
+	} else {
+		// Interpolate: one base-rate delay line, one dot product per phase (the zero-stuffed inputs
+		// are never multiplied). Decimate: push every oversampled output, compute only the one kept.
+		const float *phase = od->osInterp.coef;
 
+		IFX_FIR_Push(&od->osInterp, clipIn);
+
+		for (uint8_t p = 0; p < od->osFactor; p++) {
+			float up = IFX_FIR_Dot(&od->osInterp, phase);
+			IFX_FIR_Push(&od->osDecim, IFX_Overdrive_Clip(up, od->threshold));
+			phase += IFX_OVERDRIVE_OS_PHASE_TAPS;
+		}
+
+		clipOut = IFX_FIR_Dot(&od->osDecim, od->osDecim.coef);
+	}
+
+	// Second order IIR low-pass filter to tame the harmonics created by the clipper
+	od->lpfOutBufIn[2] = od->lpfOutBufIn[1];
+	od->lpfOutBufIn[1] = od->lpfOutBufIn[0];
+	od->lpfOutBufIn[0] = clipOut;
+
+	od->lpfOutBufOut[2] = od->lpfOutBufOut[1];
+	od->lpfOutBufOut[1] = od->lpfOutBufOut[0];
+	od->lpfOutBufOut[0] = od->lpfOutCoef[0] * (od->lpfOutBufIn[0] + 2.0f * od->lpfOutBufIn[1] + od->lpfOutBufIn[2])
+						+ od->lpfOutCoef[1] * od->lpfOutBufOut[1] + od->lpfOutCoef[2] * od->lpfOutBufOut[2];
+
+	od->lpfOutOut = od->lpfOutBufOut[0];
+
+	// Limit output
+	od->out = od->lpfOutOut;
+
+	if (od->out > 1.0f) {
+		od->out = 1.0f;
+	} else if (od->out < -1.0f) {
+		od->out = -1.0f;
+	}
+
+	return od->out;
 
 }
 
+DSP_FAST_CODE float IFX_Overdrive_Update(IFX_Overdrive *od, float inp) {
+	IFX_Overdrive_LatchOversampling(od);
 
+	// FIR low-pass anti-aliasing filter
+	return IFX_Overdrive_Shape(od, IFX_FIR_Update(&od->lpfInp, inp));
+}
 
+// Process a whole buffer (in and out may alias)
+DSP_FAST_CODE void IFX_Overdrive_ProcessBlock(IFX_Overdrive *od, const float *in, float *out, uint32_t n) {
 
+	// Sample by sample: interleaving the FIR with the recursive filters measured faster than
+	// running IFX_FIR_ProcessBlock over the block first (the dot product hides their latency)
+	IFX_Overdrive_LatchOversampling(od);
 
+	for (uint32_t i = 0; i < n; i++) {
+		out[i] = IFX_Overdrive_Shape(od, IFX_FIR_Update(&od->lpfInp, in[i]));
+	}
+}
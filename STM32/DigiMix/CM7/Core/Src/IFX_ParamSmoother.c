@@ -0,0 +1,138 @@
+/*
+ * IFX_ParamSmoother.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#include "IFX_ParamSmoother.h"
+#include "IFX_FastMem.h"
+
+#include <math.h>
+
+// Below this distance to the target the exponential ramp snaps to it
+#define IFX_SMOOTH_EPSILON 1.0e-6f
+
+// Control side, once at start-up (the exponential coefficient is the only libm call)
+void IFX_ParamSmoother_Init(IFX_ParamSmoother *sm, float initialValue, IFX_SmoothMode mode, uint32_t blocks) {
+
+	if (blocks == 0) {
+		blocks = 1;
+	}
+
+	sm->mode = mode;
+	sm->target = initialValue;
+	sm->current = initialValue;
+
+	sm->rampBlocks = blocks;
+	sm->step = 0.0f;
+	sm->blocksLeft = 0;
+	sm->rampTarget = initialValue;
+
+	sm->expCoef = 1.0f - expf(-1.0f / (float) blocks);
+}
+
+// Control side, with the audio path stopped (e.g. when the block size changes). Any ramp in
+// progress is finished at once.
+void IFX_ParamSmoother_SetBlocks(IFX_ParamSmoother *sm, uint32_t blocks) {
+
+	if (blocks == 0) {
+		blocks = 1;
+	}
+
+	sm->current = sm->target;
+	sm->rampTarget = sm->current;
+	sm->blocksLeft = 0;
+	sm->step = 0.0f;
+
+	sm->rampBlocks = blocks;
+	sm->expCoef = 1.0f - expf(-1.0f / (float) blocks);
+}
+
+// Control side. A single float store, safe against the audio path picking it up mid-update
+void IFX_ParamSmoother_SetTarget(IFX_ParamSmoother *sm, float value) {
+	sm->target = value;
+}
+
+// Audio side, once per block. Returns the value to reach at the end of this block and writes
+// the value at its start to *start. O(1) per block.
+DSP_FAST_CODE float IFX_ParamSmoother_Step(IFX_ParamSmoother *sm, float *start) {
+
+	float target = sm->target;
+	float cur = sm->current;
+
+	*start = cur;
+
+	if (sm->mode == IFX_SMOOTH_LINEAR) {
+		// New target: restart the ramp from where we are
+		if (target != sm->rampTarget) {
+			sm->rampTarget = target;
+			sm->step = (target - cur) / (float) sm->rampBlocks;
+			sm->blocksLeft = sm->rampBlocks;
+		}
+
+		if (sm->blocksLeft > 0) {
+			sm->blocksLeft--;
+			cur = (sm->blocksLeft == 0) ? target : cur + sm->step;
+		}
+	} else {
+		float diff = target - cur;
+
+		if (fabsf(diff) > IFX_SMOOTH_EPSILON) {
+			cur += diff * sm->expCoef;
+		} else {
+			cur = target;
+		}
+	}
+
+	sm->current = cur;
+
+	return cur;
+}
+
+// Multiply a block by a gain ramped linearly from gainStart to gainEnd (in and out may alias)
+DSP_FAST_CODE void IFX_ApplyGainRamp(const float *in, float *out, uint32_t n, float gainStart, float gainEnd) {
+
+	if (n == 0) {
+		return;
+	}
+
+	// Steady gain: plain multiply
+	if (gainStart == gainEnd) {
+		for (uint32_t i = 0; i < n; i++) {
+			out[i] = in[i] * gainEnd;
+		}
+		return;
+	}
+
+	float inc = (gainEnd - gainStart) / (float) n;
+	float g = gainStart;
+
+	for (uint32_t i = 0; i < n; i++) {
+		g += inc;
+		out[i] = in[i] * g;
+	}
+}
+
+// Same ramp, added to out instead of overwriting it (for summing channels onto a bus)
+DSP_FAST_CODE void IFX_MixGainRamp(const float *in, float *out, uint32_t n, float gainStart, float gainEnd) {
+
+	if (n == 0) {
+		return;
+	}
+
+	if (gainStart == gainEnd) {
+		for (uint32_t i = 0; i < n; i++) {
+			out[i] += in[i] * gainEnd;
+		}
+		return;
+	}
+
+	float inc = (gainEnd - gainStart) / (float) n;
+	float g = gainStart;
+
+	for (uint32_t i = 0; i < n; i++) {
+		g += inc;
+		out[i] += in[i] * g;
+	}
+}
@@ -0,0 +1,143 @@
+/*
+ * IFX_Profiler.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#if !defined(CORE_CM7) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L		// clock_gettime for the host backend
+#endif
+
+#include "IFX_Profiler.h"
+#include "IFX_Cycles.h"
+#include "IFX_FastMem.h"
+
+static void IFX_Profiler_ClearStat(IFX_ProfilerStat *stat) {
+	stat->min = 0xFFFFFFFFu;
+	stat->max = 0;
+	stat->total = 0;
+	stat->count = 0;
+}
+
+DSP_FAST_CODE static inline void IFX_Profiler_Record(IFX_ProfilerStat *stat, uint32_t elapsed) {
+	if (elapsed < stat->min) {
+		stat->min = elapsed;
+	}
+	if (elapsed > stat->max) {
+		stat->max = elapsed;
+	}
+	stat->total += elapsed;
+	stat->count++;
+}
+
+void IFX_Profiler_Init(IFX_Profiler *prof, uint32_t budget) {
+
+	prof->budget = (budget == 0) ? 1 : budget;
+	prof->numStages = 0;
+
+	for (uint32_t n = 0; n < IFX_PROFILER_MAX_STAGES; n++) {
+		prof->stageName[n] = "";
+	}
+
+	prof->dmaEvents = 0;
+	prof->blocksDone = 0;
+	prof->blockStart = 0;
+	prof->mark = 0;
+
+	IFX_Profiler_Reset(prof);
+
+	IFX_Cycles_Init();
+}
+
+// Returns the stage index to pass to StageEnd (the last stage is reused once all are taken)
+uint32_t IFX_Profiler_AddStage(IFX_Profiler *prof, const char *name) {
+
+	if (prof->numStages == IFX_PROFILER_MAX_STAGES) {
+		return IFX_PROFILER_MAX_STAGES - 1;
+	}
+
+	prof->stageName[prof->numStages] = name;
+	return prof->numStages++;
+}
+
+// Audio side only, the control side sets resetRequest instead
+void IFX_Profiler_Reset(IFX_Profiler *prof) {
+
+	IFX_Profiler_ClearStat(&prof->block);
+	for (uint32_t n = 0; n < IFX_PROFILER_MAX_STAGES; n++) {
+		IFX_Profiler_ClearStat(&prof->stage[n]);
+	}
+	for (uint32_t n = 0; n < IFX_PROFILER_HIST_BINS; n++) {
+		prof->hist[n] = 0;
+	}
+	prof->xruns = 0;
+	prof->resetRequest = 0;
+}
+
+// Control side, e.g. after a block size change. Statistics restart at the next block.
+void IFX_Profiler_SetBudget(IFX_Profiler *prof, uint32_t budget) {
+
+	prof->budget = (budget == 0) ? 1 : budget;
+	prof->resetRequest = 1;
+}
+
+DSP_FAST_CODE void IFX_Profiler_BlockBegin(IFX_Profiler *prof) {
+
+	if (prof->resetRequest) {
+		IFX_Profiler_Reset(prof);
+	}
+
+	prof->blockStart = IFX_Cycles_Now();
+	prof->mark = prof->blockStart;
+}
+
+DSP_FAST_CODE void IFX_Profiler_StageEnd(IFX_Profiler *prof, uint32_t stage) {
+
+	uint32_t now = IFX_Cycles_Now();
+
+	IFX_Profiler_Record(&prof->stage[stage], now - prof->mark);
+	prof->mark = now;
+}
+
+DSP_FAST_CODE void IFX_Profiler_BlockEnd(IFX_Profiler *prof) {
+
+	IFX_Profiler_AddBlock(prof, IFX_Cycles_Since(prof->blockStart));
+}
+
+DSP_FAST_CODE void IFX_Profiler_AddBlock(IFX_Profiler *prof, uint32_t elapsed) {
+
+	IFX_Profiler_Record(&prof->block, elapsed);
+
+	uint64_t bin = (uint64_t) elapsed * (IFX_PROFILER_HIST_BINS - 1) / prof->budget;
+	if (bin > IFX_PROFILER_HIST_BINS - 1) {
+		bin = IFX_PROFILER_HIST_BINS - 1;
+	}
+	prof->hist[bin]++;
+
+	// Each interrupt hands over one block. If more interrupts than finished blocks have been seen,
+	// the next one fired while this block was still running.
+	uint32_t events = prof->dmaEvents;
+
+	prof->blocksDone++;
+	if ((int32_t) (events - prof->blocksDone) > 0) {
+		prof->xruns++;
+
+		// Blocks whose interrupt was merged with another are lost for good, only keep the one pending
+		prof->blocksDone = events - 1;
+	} else if ((int32_t) (events - prof->blocksDone) < 0) {
+		// More blocks run than interrupts (catch-up after merged interrupts), resynchronise
+		prof->blocksDone = events;
+	}
+}
+
+void IFX_Profiler_DmaEvent(IFX_Profiler *prof) {
+	prof->dmaEvents++;
+}
+
+uint32_t IFX_Profiler_Average(const IFX_ProfilerStat *stat) {
+
+	if (stat->count == 0) {
+		return 0;
+	}
+	return (uint32_t) (stat->total / stat->count);
+}
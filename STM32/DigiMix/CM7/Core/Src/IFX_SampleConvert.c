@@ -0,0 +1,208 @@
+/*
+ * IFX_SampleConvert.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#include "IFX_SampleConvert.h"
+#include "IFX_FastMem.h"
+
+#if defined(CORE_CM7)
+#include "stm32h7xx.h"		// __SSAT, __PKHBT
+#endif
+
+#define IFX_INT16_SCALE 32767.0f
+#define IFX_INT16_INV_SCALE (1.0f / 32767.0f)
+
+#define IFX_INT24_SCALE 8388608.0f
+#define IFX_INT24_SLOT_INV_SCALE (1.0f / 2147483648.0f)	// left-aligned slot = sample * 2^8
+
+// Float (already scaled to the 16-bit range) to a saturated 16-bit integer, same scheme as below
+DSP_FAST_CODE static inline int32_t IFX_SatInt16(float x) {
+#if defined(CORE_CM7)
+	return __SSAT((int32_t) x, 16);
+#else
+	if (x > 32767.0f) {
+		return 32767;
+	} else if (x < -32768.0f) {
+		return -32768;
+	}
+	return (int32_t) x;
+#endif
+}
+
+// Two saturated 16-bit samples in one word, l in the low half
+DSP_FAST_CODE static inline int32_t IFX_PackInt16(float l, float r) {
+#if defined(CORE_CM7)
+	return (int32_t) __PKHBT(IFX_SatInt16(l), IFX_SatInt16(r), 16);
+#else
+	return (int32_t) (((uint32_t) IFX_SatInt16(l) & 0xFFFFu) | ((uint32_t) IFX_SatInt16(r) << 16));
+#endif
+}
+
+// Float (already scaled to the 24-bit range) to a saturated 24-bit integer.
+// On the M7, VCVT saturates to int32 and SSAT does the 24-bit clamp in one cycle; elsewhere the
+// clamp is done in float first so the conversion is always defined.
+DSP_FAST_CODE static inline int32_t IFX_SatInt24(float x) {
+#if defined(CORE_CM7)
+	return __SSAT((int32_t) x, 24);
+#else
+	if (x > 8388607.0f) {
+		return 8388607;
+	} else if (x < -8388608.0f) {
+		return -8388608;
+	}
+	return (int32_t) x;
+#endif
+}
+
+void IFX_Int16ToFloat(const int16_t *in, uint32_t inStride, float *out, uint32_t n) {
+
+	for (uint32_t i = 0; i < n; i++) {
+		out[i] = (float) *in * IFX_INT16_INV_SCALE;
+		in += inStride;
+	}
+}
+
+DSP_FAST_CODE void IFX_FloatToInt16(const float *in, int16_t *out, uint32_t outStride, uint32_t n) {
+
+	for (uint32_t i = 0; i < n; i++) {
+		*out = (int16_t) IFX_SatInt16(in[i] * IFX_INT16_SCALE);
+		out += outStride;
+	}
+}
+
+void IFX_Int16StereoToFloat(const int32_t *in, float *left, float *right, uint32_t outStride, uint32_t n) {
+
+	uint32_t i = 0;
+
+	for (; i + 2 <= n; i += 2) {
+		int32_t w0 = in[i];
+		int32_t w1 = in[i + 1];
+
+		left[0] = (float) (int16_t) w0 * IFX_INT16_INV_SCALE;
+		right[0] = (float) (w0 >> 16) * IFX_INT16_INV_SCALE;
+		left[outStride] = (float) (int16_t) w1 * IFX_INT16_INV_SCALE;
+		right[outStride] = (float) (w1 >> 16) * IFX_INT16_INV_SCALE;
+
+		left += 2 * outStride;
+		right += 2 * outStride;
+	}
+	for (; i < n; i++) {
+		int32_t w = in[i];
+
+		*left = (float) (int16_t) w * IFX_INT16_INV_SCALE;
+		*right = (float) (w >> 16) * IFX_INT16_INV_SCALE;
+	}
+}
+
+DSP_FAST_CODE void IFX_FloatToInt16Stereo(const float *left, const float *right, uint32_t inStride, int32_t *out, uint32_t n) {
+
+	uint32_t i = 0;
+
+	for (; i + 2 <= n; i += 2) {
+		out[i] = IFX_PackInt16(left[0] * IFX_INT16_SCALE, right[0] * IFX_INT16_SCALE);
+		out[i + 1] = IFX_PackInt16(left[inStride] * IFX_INT16_SCALE, right[inStride] * IFX_INT16_SCALE);
+
+		left += 2 * inStride;
+		right += 2 * inStride;
+	}
+	for (; i < n; i++) {
+		out[i] = IFX_PackInt16(*left * IFX_INT16_SCALE, *right * IFX_INT16_SCALE);
+	}
+}
+
+// Unrolled by four: no SIMD float on the M7, but independent loads/converts/stores dual-issue
+void IFX_Int24ToFloat(const int32_t *in, uint32_t inStride, float *out, uint32_t n) {
+
+	uint32_t i = 0;
+
+	for (; i + 4 <= n; i += 4) {
+		int32_t s0 = in[0];
+		int32_t s1 = in[inStride];
+		int32_t s2 = in[2 * inStride];
+		int32_t s3 = in[3 * inStride];
+
+		out[i] = (float) s0 * IFX_INT24_SLOT_INV_SCALE;
+		out[i + 1] = (float) s1 * IFX_INT24_SLOT_INV_SCALE;
+		out[i + 2] = (float) s2 * IFX_INT24_SLOT_INV_SCALE;
+		out[i + 3] = (float) s3 * IFX_INT24_SLOT_INV_SCALE;
+
+		in += 4 * inStride;
+	}
+	for (; i < n; i++) {
+		out[i] = (float) *in * IFX_INT24_SLOT_INV_SCALE;
+		in += inStride;
+	}
+}
+
+void IFX_FloatToInt24(const float *in, int32_t *out, uint32_t outStride, uint32_t n) {
+
+	uint32_t i = 0;
+
+	for (; i + 4 <= n; i += 4) {
+		int32_t s0 = IFX_SatInt24(in[i] * IFX_INT24_SCALE);
+		int32_t s1 = IFX_SatInt24(in[i + 1] * IFX_INT24_SCALE);
+		int32_t s2 = IFX_SatInt24(in[i + 2] * IFX_INT24_SCALE);
+		int32_t s3 = IFX_SatInt24(in[i + 3] * IFX_INT24_SCALE);
+
+		// Left align: multiply rather than shift a negative value
+		out[0] = s0 * 256;
+		out[outStride] = s1 * 256;
+		out[2 * outStride] = s2 * 256;
+		out[3 * outStride] = s3 * 256;
+
+		out += 4 * outStride;
+	}
+	for (; i < n; i++) {
+		*out = IFX_SatInt24(in[i] * IFX_INT24_SCALE) * 256;
+		out += outStride;
+	}
+}
+
+DSP_FAST_CODE void IFX_Int24ToFloatPlanar(const int32_t *in, uint32_t numCh, float *const *out, uint32_t n) {
+
+	uint32_t i = 0;
+
+	for (; i + 4 <= n; i += 4) {
+		for (uint32_t ch = 0; ch < numCh; ch++) {
+			float *o = &out[ch][i];
+
+			o[0] = (float) in[ch] * IFX_INT24_SLOT_INV_SCALE;
+			o[1] = (float) in[ch + numCh] * IFX_INT24_SLOT_INV_SCALE;
+			o[2] = (float) in[ch + 2 * numCh] * IFX_INT24_SLOT_INV_SCALE;
+			o[3] = (float) in[ch + 3 * numCh] * IFX_INT24_SLOT_INV_SCALE;
+		}
+		in += 4 * numCh;
+	}
+	for (; i < n; i++) {
+		for (uint32_t ch = 0; ch < numCh; ch++) {
+			out[ch][i] = (float) in[ch] * IFX_INT24_SLOT_INV_SCALE;
+		}
+		in += numCh;
+	}
+}
+
+DSP_FAST_CODE void IFX_FloatPlanarToInt24(const float *const *in, uint32_t numCh, int32_t *out, uint32_t n) {
+
+	uint32_t i = 0;
+
+	for (; i + 4 <= n; i += 4) {
+		for (uint32_t ch = 0; ch < numCh; ch++) {
+			const float *x = &in[ch][i];
+
+			out[ch] = IFX_SatInt24(x[0] * IFX_INT24_SCALE) * 256;
+			out[ch + numCh] = IFX_SatInt24(x[1] * IFX_INT24_SCALE) * 256;
+			out[ch + 2 * numCh] = IFX_SatInt24(x[2] * IFX_INT24_SCALE) * 256;
+			out[ch + 3 * numCh] = IFX_SatInt24(x[3] * IFX_INT24_SCALE) * 256;
+		}
+		out += 4 * numCh;
+	}
+	for (; i < n; i++) {
+		for (uint32_t ch = 0; ch < numCh; ch++) {
+			out[ch] = IFX_SatInt24(in[ch][i] * IFX_INT24_SCALE) * 256;
+		}
+		out += numCh;
+	}
+}
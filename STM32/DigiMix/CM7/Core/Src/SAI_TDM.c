@@ -0,0 +1,207 @@
+/*
+ * SAI_TDM.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "SAI_TDM.h"
+
+// 32-bit data and slots
+#define SAI_TDM_DS_32 7U
+#define SAI_TDM_FRAME_BITS (SAI_TDM_SLOTS * 32U)
+
+// MCLK = 256 fs with NODIV = 0
+#define SAI_TDM_MCLK_FS 256U
+#define SAI_TDM_MCKDIV_MAX 63U
+
+// Time allowed for a block to finish its current frame when disabled
+#define SAI_TDM_DISABLE_TIMEOUT_MS 2U
+
+DMA_HandleTypeDef hdma_sai1_a;
+DMA_HandleTypeDef hdma_sai1_b;
+
+static volatile uint32_t saiErrors;
+
+__weak void SAI_TDM_HalfCpltCallback(uint8_t half) {
+	(void) half;
+}
+
+// Receive DMA events. Also the place to notice FIFO errors: one register read per half buffer.
+static void SAI_TDM_Check(void) {
+	if ((SAI1_Block_A->SR | SAI1_Block_B->SR) & SAI_xSR_OVRUDR) {
+		SAI1_Block_A->CLRFR = SAI_xCLRFR_COVRUDR;
+		SAI1_Block_B->CLRFR = SAI_xCLRFR_COVRUDR;
+		saiErrors++;
+	}
+}
+
+static void SAI_TDM_RxHalfCplt(DMA_HandleTypeDef *hdma) {
+	(void) hdma;
+	SAI_TDM_Check();
+	SAI_TDM_HalfCpltCallback(0);
+}
+
+static void SAI_TDM_RxCplt(DMA_HandleTypeDef *hdma) {
+	(void) hdma;
+	SAI_TDM_Check();
+	SAI_TDM_HalfCpltCallback(1);
+}
+
+static void SAI_TDM_DmaError(DMA_HandleTypeDef *hdma) {
+	(void) hdma;
+	saiErrors++;
+}
+
+// Clear SAIEN and wait for the block to finish its frame
+static HAL_StatusTypeDef SAI_TDM_Disable(SAI_Block_TypeDef *block) {
+
+	uint32_t start = HAL_GetTick();
+
+	block->CR1 &= ~SAI_xCR1_SAIEN;
+	while (block->CR1 & SAI_xCR1_SAIEN) {
+		if (HAL_GetTick() - start > SAI_TDM_DISABLE_TIMEOUT_MS) {
+			return HAL_TIMEOUT;
+		}
+	}
+
+	return HAL_OK;
+}
+
+static HAL_StatusTypeDef SAI_TDM_InitDma(DMA_HandleTypeDef *hdma, DMA_Stream_TypeDef *stream, uint32_t request, uint32_t direction) {
+
+	hdma->Instance = stream;
+	hdma->Init.Request = request;
+	hdma->Init.Direction = direction;
+	hdma->Init.PeriphInc = DMA_PINC_DISABLE;
+	hdma->Init.MemInc = DMA_MINC_ENABLE;
+	hdma->Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+	hdma->Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+	hdma->Init.Mode = DMA_CIRCULAR;
+	hdma->Init.Priority = DMA_PRIORITY_VERY_HIGH;
+	hdma->Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+
+	return HAL_DMA_Init(hdma);
+}
+
+// Clocks, pins, DMA streams and the frame format. The SAI kernel clock is PLL2P, the clock the
+// I2S links already use; sampleRate_Hz must divide it exactly as 256 * fs * MCKDIV.
+HAL_StatusTypeDef SAI_TDM_Init(uint32_t sampleRate_Hz) {
+
+	GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+	__HAL_RCC_SAI1_CONFIG(RCC_SAI1CLKSOURCE_PLL2);
+	__HAL_RCC_SAI1_CLK_ENABLE();
+	__HAL_RCC_GPIOE_CLK_ENABLE();
+
+	uint32_t kernel = HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_SAI1);
+	uint32_t mckdiv = (sampleRate_Hz == 0) ? 0 : kernel / (SAI_TDM_MCLK_FS * sampleRate_Hz);
+
+	if (mckdiv == 0 || mckdiv > SAI_TDM_MCKDIV_MAX || mckdiv * SAI_TDM_MCLK_FS * sampleRate_Hz != kernel) {
+		return HAL_ERROR;
+	}
+
+	GPIO_InitStruct.Pin = GPIO_PIN_2 | GPIO_PIN_3 | GPIO_PIN_4 | GPIO_PIN_5 | GPIO_PIN_6;
+	GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+	GPIO_InitStruct.Pull = GPIO_NOPULL;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
+	GPIO_InitStruct.Alternate = GPIO_AF6_SAI1;
+	HAL_GPIO_Init(GPIOE, &GPIO_InitStruct);
+
+	__HAL_RCC_DMA1_CLK_ENABLE();
+	if (SAI_TDM_InitDma(&hdma_sai1_a, DMA1_Stream3, DMA_REQUEST_SAI1_A, DMA_MEMORY_TO_PERIPH) != HAL_OK ||
+		SAI_TDM_InitDma(&hdma_sai1_b, DMA1_Stream6, DMA_REQUEST_SAI1_B, DMA_PERIPH_TO_MEMORY) != HAL_OK) {
+		return HAL_ERROR;
+	}
+
+	hdma_sai1_b.XferHalfCpltCallback = SAI_TDM_RxHalfCplt;
+	hdma_sai1_b.XferCpltCallback = SAI_TDM_RxCplt;
+	hdma_sai1_b.XferErrorCallback = SAI_TDM_DmaError;
+
+	HAL_NVIC_SetPriority(DMA1_Stream6_IRQn, SAI_TDM_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(DMA1_Stream6_IRQn);
+
+	if (SAI_TDM_Disable(SAI1_Block_A) != HAL_OK || SAI_TDM_Disable(SAI1_Block_B) != HAL_OK) {
+		return HAL_TIMEOUT;
+	}
+
+	// No external synchronisation
+	SAI1->GCR = 0;
+
+	// 32-bit data, MSB first, outputs change on the SCK falling edge and inputs are sampled on the
+	// rising edge (I2S/TDM timing). A: master transmitter driving MCLK. B: receiver synchronous to A.
+	uint32_t cr1 = (SAI_TDM_DS_32 << SAI_xCR1_DS_Pos) | SAI_xCR1_CKSTR;
+
+	SAI1_Block_A->CR1 = cr1 | (0U << SAI_xCR1_MODE_Pos) | (mckdiv << SAI_xCR1_MCKDIV_Pos) | SAI_xCR1_MCKEN;
+	SAI1_Block_B->CR1 = cr1 | (3U << SAI_xCR1_MODE_Pos) | (1U << SAI_xCR1_SYNCEN_Pos);
+
+	// Frame: SAI_TDM_SLOTS slots, one bit-clock wide FS pulse, active high, one bit before slot 0
+	uint32_t frcr = ((SAI_TDM_FRAME_BITS - 1U) << SAI_xFRCR_FRL_Pos) | (0U << SAI_xFRCR_FSALL_Pos) | SAI_xFRCR_FSPOL | SAI_xFRCR_FSOFF;
+	uint32_t slotr = ((SAI_TDM_SLOTS - 1U) << SAI_xSLOTR_NBSLOT_Pos) | (((1U << SAI_TDM_SLOTS) - 1U) << SAI_xSLOTR_SLOTEN_Pos);
+
+	SAI1_Block_A->FRCR = frcr;
+	SAI1_Block_B->FRCR = frcr;
+	SAI1_Block_A->SLOTR = slotr;
+	SAI1_Block_B->SLOTR = slotr;
+
+	SAI1_Block_A->CR2 = SAI_xCR2_FFLUSH;
+	SAI1_Block_B->CR2 = SAI_xCR2_FFLUSH;
+
+	saiErrors = 0;
+
+	return HAL_OK;
+}
+
+// Start both circular DMAs, then the blocks: receiver first so it is waiting when the master
+// starts the clocks. The transmit FIFO is filled from txBuf before the first frame.
+HAL_StatusTypeDef SAI_TDM_Start(int32_t *txBuf, int32_t *rxBuf, uint32_t frames) {
+
+	uint32_t words = frames * SAI_TDM_SLOTS * 2U;
+
+	if (txBuf == NULL || rxBuf == NULL || frames == 0 || words > 0xFFFFU) {
+		return HAL_ERROR;
+	}
+
+	SAI1_Block_A->CR2 |= SAI_xCR2_FFLUSH;
+	SAI1_Block_B->CR2 |= SAI_xCR2_FFLUSH;
+	SAI1_Block_A->CLRFR = SAI_xCLRFR_COVRUDR;
+	SAI1_Block_B->CLRFR = SAI_xCLRFR_COVRUDR;
+
+	if (HAL_DMA_Start_IT(&hdma_sai1_b, (uint32_t) &SAI1_Block_B->DR, (uint32_t) rxBuf, words) != HAL_OK) {
+		return HAL_ERROR;
+	}
+	// Transmit runs in lockstep with receive, so it needs no interrupts of its own
+	if (HAL_DMA_Start(&hdma_sai1_a, (uint32_t) txBuf, (uint32_t) &SAI1_Block_A->DR, words) != HAL_OK) {
+		HAL_DMA_Abort(&hdma_sai1_b);
+		return HAL_ERROR;
+	}
+
+	SAI1_Block_B->CR1 |= SAI_xCR1_DMAEN;
+	SAI1_Block_A->CR1 |= SAI_xCR1_DMAEN;
+
+	SAI1_Block_B->CR1 |= SAI_xCR1_SAIEN;
+	SAI1_Block_A->CR1 |= SAI_xCR1_SAIEN;
+
+	return HAL_OK;
+}
+
+// Master first, so the receiver stops on a frame boundary, then the DMAs
+HAL_StatusTypeDef SAI_TDM_Stop(void) {
+
+	HAL_StatusTypeDef status = HAL_OK;
+
+	if (SAI_TDM_Disable(SAI1_Block_A) != HAL_OK || SAI_TDM_Disable(SAI1_Block_B) != HAL_OK) {
+		status = HAL_TIMEOUT;
+	}
+
+	SAI1_Block_A->CR1 &= ~SAI_xCR1_DMAEN;
+	SAI1_Block_B->CR1 &= ~SAI_xCR1_DMAEN;
+
+	HAL_DMA_Abort(&hdma_sai1_a);
+	HAL_DMA_Abort(&hdma_sai1_b);
+
+	return status;
+}
+
+uint32_t SAI_TDM_GetErrors(void) {
+	return saiErrors;
+}
@@ -0,0 +1,87 @@
+/*
+ * UART_Frame.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "UART_Frame.h"
+
+#include <stddef.h>
+
+void UART_Frame_Init(UART_Frame *fr, UART_LineHandler onLine, UART_PacketHandler onPacket) {
+	fr->len = 0;
+	fr->packet = 0;
+	fr->discard = 0;
+	fr->overflows = 0;
+	fr->onLine = onLine;
+	fr->onPacket = onPacket;
+}
+
+void UART_Frame_Discard(UART_Frame *fr) {
+	fr->len = 0;
+	fr->discard = 1;
+}
+
+void UART_Frame_Reset(UART_Frame *fr) {
+	fr->len = 0;
+	fr->packet = 0;
+	fr->discard = 0;
+}
+
+// Line complete: strip '\r' and padding, terminate and deliver
+static void UART_Frame_EndLine(UART_Frame *fr) {
+
+	uint32_t len = fr->len;
+
+	while (len > 0 && (fr->data[len - 1] == '\r' || fr->data[len - 1] == ' ')) {
+		len--;
+	}
+
+	if (len > 0 && fr->onLine != NULL) {
+		fr->data[len] = '\0';
+		fr->onLine((const char *) fr->data, len);
+	}
+
+	fr->len = 0;
+}
+
+// 0x00: closes the packet in progress, otherwise opens one
+static void UART_Frame_Delimiter(UART_Frame *fr) {
+
+	if (fr->packet && (fr->len > 0 || fr->discard)) {
+		if (!fr->discard && fr->onPacket != NULL) {
+			fr->onPacket(fr->data, fr->len);
+		}
+		fr->packet = 0;
+	} else {
+		fr->packet = 1;
+	}
+
+	fr->len = 0;
+	fr->discard = 0;
+}
+
+void UART_Frame_Feed(UART_Frame *fr, const uint8_t *data, uint32_t n) {
+
+	for (uint32_t i = 0; i < n; i++) {
+		uint8_t c = data[i];
+
+		if (c == 0x00) {
+			UART_Frame_Delimiter(fr);
+		} else if (c == '\n' && !fr->packet) {
+			if (fr->discard) {
+				fr->discard = 0;
+				fr->len = 0;
+			} else {
+				UART_Frame_EndLine(fr);
+			}
+		} else if (!fr->discard) {
+			if (fr->len < (fr->packet ? UART_FRAME_PACKET_MAX : UART_FRAME_MAX)) {
+				fr->data[fr->len++] = c;
+			} else {
+				fr->overflows++;
+				UART_Frame_Discard(fr);
+			}
+		}
+	}
+}
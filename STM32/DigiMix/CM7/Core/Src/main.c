@@ -22,28 +22,142 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+	#include <stdio.h>
 	#include <string.h>
 	#include <math.h>
 	#include <stdlib.h>
 	#include <stdarg.h>
 	#include <stdbool.h>
 
-	#include "IFX_PeakingFilter.h"
+	#include "IFX_BiquadCascade.h"
+	#include "IFX_ParamSmoother.h"
+	#include "IFX_CoefDesign.h"
+	#include "IFX_SampleConvert.h"
+	#include "IFX_Bench.h"
+	#include "IFX_Overdrive.h"
+	#include "IFX_Profiler.h"
+	#include "IFX_Cycles.h"
+	#include "IFX_FastMem.h"
+	#include "UART_Frame.h"
+	#include "CTRL_Link.h"
+	#include "SAI_TDM.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
 /* USER CODE BEGIN PTD */
-	#define FLOAT_TO_INT24(value) ((int32_t)((value) * 8388608.0f))  // Scale the float value to 16-bit range
-	#define FLOAT_TO_INT16(value) ((int16_t)((value) * 32767.0f))  // Scale the float value to 16-bit range
-	#define INT16_TO_FLOAT(value) ((float)(value) / 32767.0f)       // Convert from int16_t to float
-	#define INT24_TO_FLOAT(value) ((float)(value) / 8388608.0f) // 24-bit to float
-
 	#define ARRAY_LEN(x)            (sizeof(x) / sizeof((x)[0]))
 
 	#define SAMPLE_RATE_HZ 48000.0f
 
-	//192
-	#define BUFFER_SIZE 192
+	// Largest block, in stereo frames. The DMA buffers are sized for it, smaller latency modes
+	// use the start of them.
+	#define AUDIO_BLOCK_MAX 256
+
+	// 32-bit slots per half buffer at AUDIO_BLOCK_MAX (I2S3 and I2S1 run 24-bit data in 32-bit slots,
+	// L then R)
+	#define BUFFER_SIZE (AUDIO_BLOCK_MAX * 2)
+
+	// 1: the I2S buffers (.rxBuffer1 to .txBuffer2, 0x30010000-0x30017FFF) are write-back cacheable and
+	// processData invalidates / cleans exactly the half it works on. 0: they stay in the MPU's
+	// non-cacheable window with the UART buffers. Compare the input and output stages of 'p'.
+	#ifndef AUDIO_BUFFERS_CACHEABLE
+	#define AUDIO_BUFFERS_CACHEABLE 0
+	#endif
+
+	// 1: audio in and out over SAI1 as one TDM link of SAI_TDM_SLOTS channels (SAI_TDM.h) instead of
+	// the two I2S links. Slots past NUM_CHANNELS are not mixed, the output buses go to the first
+	// NUM_OUTPUTS slots and the other slots send silence. The TDM buffers take the I2S buffers' 8 KB
+	// sections, which limits blocks to AUDIO_TDM_BLOCK_MAX frames (128 at 8 slots).
+	#ifndef AUDIO_USE_SAI_TDM
+	#define AUDIO_USE_SAI_TDM 0
+	#endif
+
+	#define AUDIO_TDM_BLOCK_MAX (0x2000U / (SAI_TDM_SLOTS * sizeof(int32_t) * 2U))
+
+	// Interleaved slots per frame in adcData / dacData
+	#if AUDIO_USE_SAI_TDM
+	#define AUDIO_IN_SLOTS SAI_TDM_SLOTS
+	#define AUDIO_OUT_SLOTS SAI_TDM_SLOTS
+	#define AUDIO_BUFFER_WORDS (AUDIO_TDM_BLOCK_MAX * SAI_TDM_SLOTS * 2U)
+	#else
+	#define AUDIO_IN_SLOTS NUM_CHANNELS
+	#define AUDIO_OUT_SLOTS NUM_OUTPUTS
+	#define AUDIO_BUFFER_WORDS (BUFFER_SIZE * 2)
+	#endif
+
+	// Latency mode used at start-up (index into latencyModes)
+	#define LATENCY_MODE_DEFAULT 2
+
+	// Mixer layout advertised by the UI: 4 channels, up to 5 EQ bands each
+	#define NUM_CHANNELS 4
+	#define NUM_EQ_BANDS 5
+
+	// Stereo output: channel n is summed onto output n % NUM_OUTPUTS (CH1 & CH3 left, CH2 & CH4 right)
+	#define NUM_OUTPUTS 2
+
+	// Parameter smoothing time, converted to blocks for the current latency mode
+	#define GAIN_SMOOTH_MS 8.0f
+	#define EQ_SMOOTH_MS 16.0f
+
+	// Channel number the UI uses for the master fader
+	#define MASTER_CHANNEL 9
+
+	// Overdrive insert defaults (pre-gain is set from the UI)
+	#define DRIVE_HPF_HZ 80.0f
+	#define DRIVE_LPF_HZ 6000.0f
+	#define DRIVE_LPF_DAMPING 0.707f
+	#define DRIVE_PRE_GAIN 4.0f
+
+	// processDataTask thread flags: bit n = half n of adcData/dacData is ready
+	#define AUDIO_FLAG_HALF(n) (1U << (n))
+	#define AUDIO_FLAGS (AUDIO_FLAG_HALF(0) | AUDIO_FLAG_HALF(1))
+
+	// Inputs that must have filled a buffer half before it is processed
+	#define AUDIO_SRC_I2S3 0x01U		// CH1 & CH2, master (CK, WS, MCK)
+	#define AUDIO_SRC_I2S1 0x02U		// CH3 & CH4, slave on I2S3's CK and WS
+	#define AUDIO_SRC_SAI 0x04U			// all channels, SAI1 TDM (AUDIO_USE_SAI_TDM)
+	#if AUDIO_USE_SAI_TDM
+	#define AUDIO_SRCS AUDIO_SRC_SAI
+	#else
+	#define AUDIO_SRCS (AUDIO_SRC_I2S3 | AUDIO_SRC_I2S1)
+	#endif
+
+	// Control link from the ESP32 on UART2, received by a circular DMA into uartData: binary CTRL_Link
+	// frames from the UI and '\n' terminated ASCII commands from a console. At 4 Mbaud the DMA laps
+	// the ring every 2.5 ms and hands half of it to the framer every 1.3 ms.
+	#define UART_RX_RING 1024
+
+	// UART2 rate negotiation (CTRL_Link LINK_* messages), in ms (kernel ticks). The trial and poll
+	// times shared with the ESP32 are in CTRL_Link.h.
+	#define LINK_TIMEOUT_MS 3500		// no valid frame at a negotiated rate for this long: back to safe
+	#define LINK_TX_TIMEOUT_MS 10		// LINK_ACK / LINK_STATS held off by CTS for longer are dropped
+
+	#define LINK_STATE_SAFE 0			// CTRL_LINK_BAUD_SAFE, no flow control
+	#define LINK_STATE_TRIAL 1			// switched, waiting for the first ping
+	#define LINK_STATE_UP 2				// negotiated rate confirmed
+
+	#if CTRL_LINK_MAX_ENCODED > UART_FRAME_PACKET_MAX
+	#error "UART_Frame packets too short for CTRL_Link frames"
+	#endif
+
+	// processData stages timed by dspProfile, in processing order
+	#define PROF_STAGE_INPUT 0
+	#define PROF_STAGE_EQ 1
+	#define PROF_STAGE_DRIVE 2
+	#define PROF_STAGE_GAIN 3
+	#define PROF_STAGE_OUTPUT 4
+
+	// Audio tap points ('t' command): which signal processData streams out of UART3
+	#define TAP_OFF 0
+	#define TAP_INPUT 1			// channel after conversion
+	#define TAP_EQ 2			// channel after the EQ
+	#define TAP_OUTPUT 3		// output bus after the mix
+
+	// int16 samples in tapRing, fills the 8 KB .txUARTBuffer1 section
+	#define TAP_RING_SAMPLES 4096
+
+	// Longest tap DMA segment, and so the longest a console print waits for UART3 (44 ms at 115200)
+	#define TAP_SEGMENT_SAMPLES 256
 /* USER CODE END PTD */
 
 /* Private define ------------------------------------------------------------*/
@@ -63,6 +177,7 @@
 
 I2S_HandleTypeDef hi2s1;
 I2S_HandleTypeDef hi2s3;
+DMA_HandleTypeDef hdma_spi1_rx;
 DMA_HandleTypeDef hdma_spi3_rx;
 DMA_HandleTypeDef hdma_spi3_tx;
 
@@ -77,8 +192,8 @@ DMA_HandleTypeDef hdma_usart3_tx;
 osThreadId_t filterTaskHandle;
 const osThreadAttr_t filterTask_attributes = {
   .name = "filterTask",
-  .stack_size = 128 * 4,
-  .priority = (osPriority_t) osPriorityNormal,
+  .stack_size = 512 * 4,
+  .priority = (osPriority_t) osPriorityBelowNormal,
 };
 /* Definitions for processData */
 osThreadId_t processDataHandle;
@@ -92,16 +207,6 @@ osMessageQueueId_t uartQueueHandle;
 const osMessageQueueAttr_t uartQueue_attributes = {
   .name = "uartQueue"
 };
-/* Definitions for i2sHalfFull */
-osSemaphoreId_t i2sHalfFullHandle;
-const osSemaphoreAttr_t i2sHalfFull_attributes = {
-  .name = "i2sHalfFull"
-};
-/* Definitions for i2sFull */
-osSemaphoreId_t i2sFullHandle;
-const osSemaphoreAttr_t i2sFull_attributes = {
-  .name = "i2sFull"
-};
 /* Definitions for uartFull */
 osSemaphoreId_t uartFullHandle;
 const osSemaphoreAttr_t uartFull_attributes = {
@@ -114,35 +219,144 @@ const osSemaphoreAttr_t uartFull_attributes = {
 		float gain;
 	} FilterParams;
 
-	// CH1 & CH2
-	__attribute__ ((section(".rxBuffer1"), used)) __attribute__ ((aligned (32))) uint16_t adcData[BUFFER_SIZE*2] = {0};
-	__attribute__ ((section(".txBuffer1"), used)) __attribute__ ((aligned (32))) uint16_t dacData[BUFFER_SIZE*2] = {0};
+	// CH1 & CH2 (with AUDIO_USE_SAI_TDM: every channel, SAI_TDM_SLOTS per frame)
+	__attribute__ ((section(".rxBuffer1"), used)) __attribute__ ((aligned (32))) int32_t adcData[AUDIO_BUFFER_WORDS] = {0};
+	__attribute__ ((section(".txBuffer1"), used)) __attribute__ ((aligned (32))) int32_t dacData[AUDIO_BUFFER_WORDS] = {0};
 
-	__attribute__ ((section(".txUARTBuffer1"), used)) __attribute__ ((aligned (32))) uint16_t uartBuffer[BUFFER_SIZE*2] = {0};
+	// Audio tap: processData converts the tapped block to int16 straight into tapRing, the UART3
+	// transmit DMA drains it one contiguous segment at a time, each segment started from the previous
+	// one's completion. Head and tail run freely, the ring index is taken modulo TAP_RING_SAMPLES.
+	__attribute__ ((section(".txUARTBuffer1"), used)) __attribute__ ((aligned (32))) int16_t tapRing[TAP_RING_SAMPLES] = {0};
+
+	#if !AUDIO_USE_SAI_TDM
+	// CH3 & CH4 (I2S1 is receive only, these channels are mixed into dacData)
+	__attribute__ ((section(".rxBuffer2"), used)) __attribute__ ((aligned (32))) int32_t adcData2[BUFFER_SIZE*2] = {0};
+	#endif
+	//__attribute__ ((section(".txBuffer2"), used)) __attribute__ ((aligned (32))) int32_t dacData2[BUFFER_SIZE*2] = {0};
+
+	// Interleaved input links, in channel order: each one fills `slots` consecutive channels from
+	// its DMA buffer (24-bit data in 32-bit slots, slots words per frame)
+	typedef struct {
+		const int32_t *buf;
+		uint32_t slots;
+	} AudioLink;
+
+	#if AUDIO_USE_SAI_TDM
+	const AudioLink audioInputs[] = {
+		{ adcData,  SAI_TDM_SLOTS },	// SAI1 TDM: CH1 to CH4, then the unmixed slots
+	};
+	#else
+	const AudioLink audioInputs[] = {
+		{ adcData,  2 },		// I2S3: CH1 & CH2
+		{ adcData2, 2 },		// I2S1: CH3 & CH4
+	};
+	#endif
 
-	// CH3 & CH4
-	//__attribute__ ((section(".rxBuffer2"), used)) __attribute__ ((aligned (32))) uint16_t adcData2[BUFFER_SIZE*2] = {0};
-	//__attribute__ ((section(".txBuffer2"), used)) __attribute__ ((aligned (32))) uint16_t dacData2[BUFFER_SIZE*2] = {0};
+	// Planar working buffers for processData: one per channel and one per output bus (DTCM, CPU only)
+	DSP_FAST_BSS float chBuf[NUM_CHANNELS][AUDIO_BLOCK_MAX];
+	DSP_FAST_BSS float busBuf[NUM_OUTPUTS][AUDIO_BLOCK_MAX];
+	#if AUDIO_USE_SAI_TDM
+	// One pointer per TDM slot, set by startAudio: input slots past NUM_CHANNELS are converted into
+	// tdmDiscard, output slots past NUM_OUTPUTS are sent from tdmSilence (never written)
+	DSP_FAST_BSS float tdmDiscard[AUDIO_BLOCK_MAX];
+	DSP_FAST_BSS float tdmSilence[AUDIO_BLOCK_MAX];
+	float *chPtr[AUDIO_IN_SLOTS];
+	const float *busPtr[AUDIO_OUT_SLOTS];
+	#else
+	float *const chPtr[NUM_CHANNELS] = { chBuf[0], chBuf[1], chBuf[2], chBuf[3] };
+	const float *const busPtr[NUM_OUTPUTS] = { busBuf[0], busBuf[1] };
+	#endif
 
 	// UART
-	__attribute__ ((section(".rxUARTBuffer"), used)) __attribute__ ((aligned (32))) uint8_t uartData[65] = {0};
+	__attribute__ ((section(".rxUARTBuffer"), used)) __attribute__ ((aligned (32))) uint8_t uartData[UART_RX_RING] = {0};
 
+	// uartQueue item: one ASCII line (NUL terminated) or one CTRL_Link frame (COBS encoded)
+	typedef struct {
+		uint8_t binary;
+		uint8_t len;
+		uint8_t data[UART_FRAME_PACKET_MAX + 1];
+	} ControlFrame;
+
+	// Splits the UART2 byte stream into lines (UART2 interrupts only)
+	UART_Frame controlFramer;
+	uint32_t controlRxPos;				// uartData index up to which bytes were fed to controlFramer
+
+	volatile uint32_t controlDrops;		// frames lost because filterTask had fallen 16 frames behind
+	volatile uint32_t controlRxErrors;	// UART2 framing/noise/overrun errors, each costs its line
+	uint32_t controlLinkErrors;			// CTRL_Link frames rejected (COBS, CRC, version, content)
+	volatile uint32_t controlRxBytes;	// bytes received on UART2
+	uint32_t controlRxFrames;			// lines and CTRL_Link frames applied
+
+	// UART2 rate and flow control (filterTask). Starts safe; the ESP32 proposes a faster rate with
+	// LINK_SETUP and keeps it alive with pings, either side drops back to safe when the other goes quiet.
+	uint32_t linkBaud = CTRL_LINK_BAUD_SAFE;
+	uint8_t linkFlags;
+	uint8_t linkState = LINK_STATE_SAFE;
+	uint32_t linkLastRx;				// tick of the last valid frame
+	uint32_t linkFallbacks;				// negotiated rates given up for the safe one
+	uint32_t linkTxErrors;				// LINK_ACK / LINK_STATS not sent
+	uint32_t linkReportBytes;			// controlRxBytes and tick at the last 'p' report
+	uint32_t linkReportTick;
+
+	// Fader positions (0..100) and mutes (control side): channels 0..NUM_CHANNELS-1, then the master
+	#define FADER_MASTER NUM_CHANNELS
+	uint8_t faderVolume[NUM_CHANNELS + 1];
+	uint8_t faderMuted[NUM_CHANNELS + 1];
 
-	static volatile uint16_t *inBufPtr;
-	static volatile uint16_t *outBufPtr = &dacData[0];
 
 	uint8_t dataReadyFlag;
 
-	float vch1 = 1.0f;
-	float vch2 = 1.0f;
-	float vmaster = 1.0f;
+	// Fader gains, ramped across each block by the audio path
+	DSP_FAST_BSS IFX_ParamSmoother chGain[NUM_CHANNELS];
+	DSP_FAST_BSS IFX_ParamSmoother masterGain;
+
+	// Filled by runBench when the 'b' command asks for the DSP benchmark
+	IFX_BenchResult benchResults[IFX_BENCH_MAX_RESULTS];
+
+	// One EQ cascade per channel
+	DSP_FAST_BSS IFX_BiquadCascade eqBank[NUM_CHANNELS];
+
+	// Overdrive insert per channel, after the EQ (bypassed until enabled with 'o')
+	DSP_FAST_BSS IFX_Overdrive chDrive[NUM_CHANNELS];
+	volatile uint8_t chDriveOn[NUM_CHANNELS];
+
+	// Block size profiles, selected with 'l'. In to out latency is two blocks: one half buffer
+	// filling while the other is processed, then one half buffer playing out.
+	typedef struct {
+		const char *name;
+		uint32_t frames;
+	} LatencyMode;
 
-	IFX_PeakingFilter filt1;
-	IFX_PeakingFilter filt2;
-	IFX_PeakingFilter filt3;
-	IFX_PeakingFilter filt4;
-	IFX_PeakingFilter filt5;
-	IFX_PeakingFilter filt6;
+	const LatencyMode latencyModes[] = {
+		{ "monitor-16",  16 },
+		{ "monitor-32",  32 },
+		{ "default",     48 },
+		{ "balanced",   128 },
+		{ "foh",        AUDIO_BLOCK_MAX },
+	};
+
+	// Frames per block the DMA is currently running with (read by processData)
+	volatile uint32_t audioBlockFrames;
+	uint32_t latencyMode;
+
+	// AUDIO_SRC_* bits of the inputs that have filled each half so far (DMA callbacks only)
+	uint8_t audioHalfSrcs[2];
+
+	// Halves handed over without waiting for both inputs (one of them stopped or slipped)
+	volatile uint32_t audioSyncErrors;
+
+	volatile uint32_t tapSelect;		// (TAP_* << 8) | channel, set by 't'
+	volatile uint32_t tapHead;			// samples written (DSP task)
+	volatile uint32_t tapTail;			// samples sent (UART3 DMA)
+	volatile uint32_t tapSending;		// samples in the transfer in flight, 0 when the DMA is idle
+	volatile uint32_t tapDrops;			// blocks dropped because the ring was full
+
+	// Set by UART_Printf while it waits for or uses UART3: the tap starts no new segment
+	volatile uint8_t consoleWaiting;
+
+	// Per-block and per-stage DSP load, queried with 'p'
+	DSP_FAST_BSS IFX_Profiler dspProfile;
+	IFX_Profiler dspProfileCopy;
 
 
 /* USER CODE END PV */
@@ -162,7 +376,38 @@ void processDataTask(void *argument);
 
 /* USER CODE BEGIN PFP */
 	void UART_Printf(const char* fmt, ...);
-	void processData();
+	void audioHalfReady(uint8_t half, uint8_t src);
+	void processData(uint8_t half);
+	void tapWrite(const float *buf, uint32_t frames);
+	void tapConvert(const float *buf, int16_t *out, uint32_t n);
+	void tapSend(void);
+	void printProfile(void);
+	HAL_StatusTypeDef startAudio(uint32_t mode);
+	void setLatencyMode(uint32_t mode);
+	void printLatencyModes(void);
+	void controlParse(const char *cmd);
+	void controlApply(const ControlFrame *frame);
+	void controlQueue(uint8_t binary, const uint8_t *data, uint32_t len);
+	void controlLineReady(const char *text, uint32_t len);
+	void controlPacketReady(const uint8_t *data, uint32_t len);
+	void controlRxFeed(uint32_t pos);
+	HAL_StatusTypeDef controlRxStart(void);
+	void controlLinkMsg(const CTRL_LinkMsg *msg, void *ctx);
+	HAL_StatusTypeDef controlLinkConfig(uint32_t baud, uint8_t flags);
+	int controlLinkBaudOk(uint32_t baud);
+	void controlLinkSend(CTRL_LinkBatch *batch);
+	void controlLinkSetup(uint32_t baud, uint8_t flags);
+	void controlLinkPing(uint8_t seq);
+	void controlLinkFallback(void);
+	void controlLinkPoll(void);
+	void printLink(void);
+	int faderIndex(int channel);
+	void controlApplyFader(int fader);
+	void controlSetFader(int channel, int volume);
+	void controlSetMute(int channel, int on);
+	void controlSetEqBand(int channel, int band, int freq, float gain_dB, float q);
+	void runBench(void);
+	void MPU_ConfigAudioBuffers(void);
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
@@ -193,6 +438,8 @@ int main(void)
   SCB_EnableDCache();
 
 /* USER CODE BEGIN Boot_Mode_Sequence_1 */
+	  MPU_ConfigAudioBuffers();
+
 	  /* Wait until CPU2 boots and enters in stop mode or timeout*/
 	  timeout = 0xFFFF;
 	  while((__HAL_RCC_GET_FLAG(RCC_FLAG_D2CKRDY) != RESET) && (timeout-- > 0));
@@ -247,39 +494,39 @@ int main(void)
   /* USER CODE BEGIN 2 */
 	  memset(dacData, 0, sizeof(dacData));
 
-	  IFX_PeakingFilter_Init(&filt1, SAMPLE_RATE_HZ);
-	  IFX_PeakingFilter_Init(&filt2, SAMPLE_RATE_HZ);
-	  IFX_PeakingFilter_Init(&filt3, SAMPLE_RATE_HZ);
-	  //  IFX_PeakingFilter_Init(&filt4, SAMPLE_RATE_HZ);
-	  //  IFX_PeakingFilter_Init(&filt5, SAMPLE_RATE_HZ);
+	  // All bands start flat
+	  for (uint8_t ch = 0; ch < NUM_CHANNELS; ch++) {
+		IFX_BiquadCascade_Init(&eqBank[ch], SAMPLE_RATE_HZ, NUM_EQ_BANDS);
 
-	  UART_Printf("Readyy!\r\n");
+		IFX_ParamSmoother_Init(&chGain[ch], 1.0f, IFX_SMOOTH_EXPONENTIAL, 1);
 
-	  // CH1
-	  IFX_PeakingFilter_SetParameters(&filt1, 1.0f, 1.0f, 1.0f);
-	  IFX_PeakingFilter_SetParameters(&filt2, 1.0f, 1.0f, 1.0f);
-	  IFX_PeakingFilter_SetParameters(&filt3, 1.0f, 1.0f, 1.0f);
+		IFX_Overdrive_Init(&chDrive[ch], SAMPLE_RATE_HZ, DRIVE_HPF_HZ, DRIVE_PRE_GAIN, DRIVE_LPF_HZ, DRIVE_LPF_DAMPING);
+		chDriveOn[ch] = 0;
+	  }
+	  IFX_ParamSmoother_Init(&masterGain, 1.0f, IFX_SMOOTH_EXPONENTIAL, 1);
+	  memset(faderVolume, 100, sizeof(faderVolume));		// unity, as the smoothers start
+
+	  // Budget is set by startAudio for the latency mode
+	  IFX_Profiler_Init(&dspProfile, 1);
+	  IFX_Profiler_AddStage(&dspProfile, "input");
+	  IFX_Profiler_AddStage(&dspProfile, "eq");
+	  IFX_Profiler_AddStage(&dspProfile, "drive");
+	  IFX_Profiler_AddStage(&dspProfile, "gain");
+	  IFX_Profiler_AddStage(&dspProfile, "output");
 
-	  // CH2
-	  IFX_PeakingFilter_SetParameters(&filt4, 1.0f, 1.0f, 1.0f);
-	  IFX_PeakingFilter_SetParameters(&filt5, 1.0f, 1.0f, 1.0f);
-	  IFX_PeakingFilter_SetParameters(&filt6, 1.0f, 1.0f, 1.0f);
+	  UART_Printf("Readyy!\r\n");
 
-	  if (HAL_I2SEx_TransmitReceive_DMA(&hi2s3, (uint16_t *) dacData, (uint16_t *) adcData, BUFFER_SIZE) != HAL_OK) {
-		UART_Printf("I2S Full-Duplex DMA initialization failed\n");
+	#if AUDIO_USE_SAI_TDM
+	  if (SAI_TDM_Init((uint32_t) SAMPLE_RATE_HZ) != HAL_OK) {
+		UART_Printf("SAI TDM initialization failed\n");
 		Error_Handler();
 	  }
-
-	  if (HAL_UART_Receive_DMA(&huart2, uartData, sizeof(uartData)) != HAL_OK) {
-		UART_Printf("UART DMA Receive initialization failed\n");
+	#endif
+	  if (startAudio(LATENCY_MODE_DEFAULT) != HAL_OK) {
+		UART_Printf("Audio DMA initialization failed\n");
 		Error_Handler();
 	  }
 
-//	  if (HAL_UART_Transmit_DMA(&huart3, (uint8_t *)uartBuffer, sizeof(uartBuffer)) != HAL_OK) {
-//	    UART_Printf("UART DMA Transmit initialization failed\n");
-//		Error_Handler();
-//	  }
-
   /* USER CODE END 2 */
 
   /* Init scheduler */
@@ -290,20 +537,13 @@ int main(void)
   /* USER CODE END RTOS_MUTEX */
 
   /* Create the semaphores(s) */
-  /* creation of i2sHalfFull */
-  i2sHalfFullHandle = osSemaphoreNew(1, 1, &i2sHalfFull_attributes);
-
-  /* creation of i2sFull */
-  i2sFullHandle = osSemaphoreNew(1, 1, &i2sFull_attributes);
-
   /* creation of uartFull */
   uartFullHandle = osSemaphoreNew(1, 1, &uartFull_attributes);
 
   /* USER CODE BEGIN RTOS_SEMAPHORES */
 	  /* add semaphores, ... */
-	  //osSemaphoreAcquire(uartFullHandle, 0);
-	  //osSemaphoreAcquire(i2sHalfFullHandle, 0);
-	  //osSemaphoreAcquire(i2sFullHandle, 0);
+	  // uartFull starts taken: the tap releases it when it gives UART3 up to a waiting print
+	  osSemaphoreAcquire(uartFullHandle, 0);
   /* USER CODE END RTOS_SEMAPHORES */
 
   /* USER CODE BEGIN RTOS_TIMERS */
@@ -312,7 +552,7 @@ int main(void)
 
   /* Create the queue(s) */
   /* creation of uartQueue */
-  uartQueueHandle = osMessageQueueNew (16, sizeof(uint16_t), &uartQueue_attributes);
+  uartQueueHandle = osMessageQueueNew (16, sizeof(ControlFrame), &uartQueue_attributes);
 
   /* USER CODE BEGIN RTOS_QUEUES */
 	  /* add queues, ... */
@@ -451,13 +691,13 @@ static void MX_I2S1_Init(void)
   hi2s1.Instance = SPI1;
   hi2s1.Init.Mode = I2S_MODE_SLAVE_RX;
   hi2s1.Init.Standard = I2S_STANDARD_PHILIPS;
-  hi2s1.Init.DataFormat = I2S_DATAFORMAT_16B;
+  hi2s1.Init.DataFormat = I2S_DATAFORMAT_24B;
   hi2s1.Init.MCLKOutput = I2S_MCLKOUTPUT_DISABLE;
-  hi2s1.Init.AudioFreq = I2S_AUDIOFREQ_8K;
+  hi2s1.Init.AudioFreq = I2S_AUDIOFREQ_48K;
   hi2s1.Init.CPOL = I2S_CPOL_LOW;
   hi2s1.Init.FirstBit = I2S_FIRSTBIT_MSB;
   hi2s1.Init.WSInversion = I2S_WS_INVERSION_DISABLE;
-  hi2s1.Init.Data24BitAlignment = I2S_DATA_24BIT_ALIGNMENT_RIGHT;
+  hi2s1.Init.Data24BitAlignment = I2S_DATA_24BIT_ALIGNMENT_LEFT;
   hi2s1.Init.MasterKeepIOState = I2S_MASTER_KEEP_IO_STATE_DISABLE;
   if (HAL_I2S_Init(&hi2s1) != HAL_OK)
   {
@@ -487,13 +727,13 @@ static void MX_I2S3_Init(void)
   hi2s3.Instance = SPI3;
   hi2s3.Init.Mode = I2S_MODE_MASTER_FULLDUPLEX;
   hi2s3.Init.Standard = I2S_STANDARD_PHILIPS;
-  hi2s3.Init.DataFormat = I2S_DATAFORMAT_16B_EXTENDED;
+  hi2s3.Init.DataFormat = I2S_DATAFORMAT_24B;
   hi2s3.Init.MCLKOutput = I2S_MCLKOUTPUT_ENABLE;
   hi2s3.Init.AudioFreq = I2S_AUDIOFREQ_48K;
   hi2s3.Init.CPOL = I2S_CPOL_LOW;
   hi2s3.Init.FirstBit = I2S_FIRSTBIT_MSB;
   hi2s3.Init.WSInversion = I2S_WS_INVERSION_DISABLE;
-  hi2s3.Init.Data24BitAlignment = I2S_DATA_24BIT_ALIGNMENT_RIGHT;
+  hi2s3.Init.Data24BitAlignment = I2S_DATA_24BIT_ALIGNMENT_LEFT;
   hi2s3.Init.MasterKeepIOState = I2S_MASTER_KEEP_IO_STATE_DISABLE;
   if (HAL_I2S_Init(&hi2s3) != HAL_OK)
   {
@@ -535,15 +775,15 @@ static void MX_USART2_UART_Init(void)
   {
     Error_Handler();
   }
-  if (HAL_UARTEx_SetTxFifoThreshold(&huart2, UART_TXFIFO_THRESHOLD_1_8) != HAL_OK)
+  if (HAL_UARTEx_SetTxFifoThreshold(&huart2, UART_TXFIFO_THRESHOLD_1_2) != HAL_OK)
   {
     Error_Handler();
   }
-  if (HAL_UARTEx_SetRxFifoThreshold(&huart2, UART_RXFIFO_THRESHOLD_1_8) != HAL_OK)
+  if (HAL_UARTEx_SetRxFifoThreshold(&huart2, UART_RXFIFO_THRESHOLD_1_2) != HAL_OK)
   {
     Error_Handler();
   }
-  if (HAL_UARTEx_DisableFifoMode(&huart2) != HAL_OK)
+  if (HAL_UARTEx_EnableFifoMode(&huart2) != HAL_OK)
   {
     Error_Handler();
   }
@@ -583,15 +823,15 @@ static void MX_USART3_UART_Init(void)
   {
     Error_Handler();
   }
-  if (HAL_UARTEx_SetTxFifoThreshold(&huart3, UART_TXFIFO_THRESHOLD_1_8) != HAL_OK)
+  if (HAL_UARTEx_SetTxFifoThreshold(&huart3, UART_TXFIFO_THRESHOLD_1_2) != HAL_OK)
   {
     Error_Handler();
   }
-  if (HAL_UARTEx_SetRxFifoThreshold(&huart3, UART_RXFIFO_THRESHOLD_1_8) != HAL_OK)
+  if (HAL_UARTEx_SetRxFifoThreshold(&huart3, UART_RXFIFO_THRESHOLD_1_2) != HAL_OK)
   {
     Error_Handler();
   }
-  if (HAL_UARTEx_DisableFifoMode(&huart3) != HAL_OK)
+  if (HAL_UARTEx_EnableFifoMode(&huart3) != HAL_OK)
   {
     Error_Handler();
   }
@@ -618,6 +858,9 @@ static void MX_DMA_Init(void)
   /* DMA1_Stream1_IRQn interrupt configuration */
   HAL_NVIC_SetPriority(DMA1_Stream1_IRQn, 5, 0);
   HAL_NVIC_EnableIRQ(DMA1_Stream1_IRQn);
+  /* DMA1_Stream2_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA1_Stream2_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream2_IRQn);
   /* DMA1_Stream4_IRQn interrupt configuration */
   HAL_NVIC_SetPriority(DMA1_Stream4_IRQn, 5, 0);
   HAL_NVIC_EnableIRQ(DMA1_Stream4_IRQn);
@@ -625,10 +868,10 @@ static void MX_DMA_Init(void)
   HAL_NVIC_SetPriority(DMA1_Stream5_IRQn, 5, 0);
   HAL_NVIC_EnableIRQ(DMA1_Stream5_IRQn);
   /* DMA2_Stream6_IRQn interrupt configuration */
-  HAL_NVIC_SetPriority(DMA2_Stream6_IRQn, 0, 0);
+  HAL_NVIC_SetPriority(DMA2_Stream6_IRQn, 5, 0);
   HAL_NVIC_EnableIRQ(DMA2_Stream6_IRQn);
   /* DMA2_Stream7_IRQn interrupt configuration */
-  HAL_NVIC_SetPriority(DMA2_Stream7_IRQn, 0, 0);
+  HAL_NVIC_SetPriority(DMA2_Stream7_IRQn, 5, 0);
   HAL_NVIC_EnableIRQ(DMA2_Stream7_IRQn);
 
 }
@@ -653,151 +896,753 @@ static void MX_GPIO_Init(void)
 }
 
 /* USER CODE BEGIN 4 */
+	// Console text on UART3, from filterTask (or before the scheduler starts). It shares the UART with
+	// the tap, whose DMA segments are chained from the transfer complete interrupt: consoleWaiting
+	// stops the chain after the current segment, then the text goes out blocking and the next tapped
+	// block restarts the DMA.
 	void UART_Printf(const char* fmt, ...) {
 	  char buff[256];
 	  va_list args;
 	  va_start(args, fmt);
 	  vsnprintf(buff, sizeof(buff), fmt, args);
-	  HAL_UART_Transmit(&huart3, (uint8_t*)buff, strlen(buff), HAL_MAX_DELAY);
 	  va_end(args);
+
+	  consoleWaiting = 1;
+	  __DMB();
+	  while (tapSending != 0) {
+		// Released when the tap goes idle; a stale release only costs another look at tapSending
+		osSemaphoreAcquire(uartFullHandle, 10);
+	  }
+	  HAL_UART_Transmit(&huart3, (uint8_t*)buff, strlen(buff), HAL_MAX_DELAY);
+	  consoleWaiting = 0;
+	}
+
+
+	// controlFramer output, one complete line or packet: queue a copy for filterTask. Nothing is
+	// parsed or printed in interrupt context, UART2 shares its priority with the audio DMA.
+	void controlQueue(uint8_t binary, const uint8_t *data, uint32_t len) {
+	  ControlFrame frame;
+	  frame.binary = binary;
+	  frame.len = (uint8_t) len;
+	  memcpy(frame.data, data, len);
+	  frame.data[len] = '\0';
+
+	  if (osMessageQueuePut(uartQueueHandle, &frame, 0, 0) != osOK) {
+		controlDrops++;
+	  }
 	}
 
+	void controlLineReady(const char *text, uint32_t len) {
+	  controlQueue(0, (const uint8_t *) text, len);
+	}
 
-	void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart) {
-		UART_Printf("callback");
-		HAL_UART_Transmit(&huart3, (uint8_t*)uartData, sizeof(uartData), HAL_MAX_DELAY);
-		if (uartData[0] == 'f') {
-		  FilterParams newParams = {0.0f, 0.0f, 0.0f};
-		  uint8_t channel = 0, filter = 0, freq = 0;
+	void controlPacketReady(const uint8_t *data, uint32_t len) {
+	  controlQueue(1, data, len);
+	}
 
-		  sscanf(uartData, "%c,%d,%d,%d,%f,%f", NULL, &channel, &filter, &newParams.centerFrequency, &newParams.gain, &newParams.qFactor);
-		  //sscanf(uartData, "%c,%f,%f,%f", NULL, &newParams.centerFrequency, &newParams.qFactor, &newParams.gain);
+	// Feed controlFramer the bytes the DMA has written since the last call, up to uartData[pos]
+	void controlRxFeed(uint32_t pos) {
+	  if (pos < controlRxPos) {
+		controlRxBytes += UART_RX_RING - controlRxPos;
+		UART_Frame_Feed(&controlFramer, &uartData[controlRxPos], UART_RX_RING - controlRxPos);
+		controlRxPos = 0;
+	  }
+	  controlRxBytes += pos - controlRxPos;
+	  UART_Frame_Feed(&controlFramer, &uartData[controlRxPos], pos - controlRxPos);
+	  controlRxPos = (pos == UART_RX_RING) ? 0 : pos;
+	}
 
-		  newParams.gain = powf(10.0f, newParams.gain / 20.0f);
-		  char printBuffer[64];
-		  snprintf(printBuffer, sizeof(printBuffer), "CH: %d\n\r#F: %d\n\rCF: %d \n\rQ: %.5f \n\rGain: %.5f \n\r", channel, filter, newParams.centerFrequency, newParams.qFactor, newParams.gain);
+	// Start the circular UART2 reception at the beginning of uartData
+	HAL_StatusTypeDef controlRxStart(void) {
+	  controlRxPos = 0;
+	  return HAL_UARTEx_ReceiveToIdle_DMA(&huart2, uartData, UART_RX_RING);
+	}
 
+	// UART2 half buffer, full buffer and idle line: pos is the DMA write index into uartData
+	void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t pos) {
+	  if (huart->Instance == USART2) {
+		controlRxFeed(pos);
+	  }
+	}
+
+	// UART2 receive error. With DMA reception the H7 HAL treats every error (noise, framing, parity,
+	// overrun) as blocking: it aborts the DMA and only then calls here, with the stream stopped. Feed
+	// what arrived before the error, drop the line or packet the bad byte is in and start again.
+	void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart) {
+	  if (huart->Instance == USART3) {
+		// Tap segment aborted: drop it and hand the UART to a waiting print
+		if (tapSending != 0) {
+		  tapTail += tapSending;
+		  tapSending = 0;
+		  osSemaphoreRelease(uartFullHandle);
+		}
+		return;
+	  }
+	  if (huart->Instance != USART2) {
+		return;
+	  }
+
+	  controlRxErrors++;
+
+	  controlRxFeed(UART_RX_RING - __HAL_DMA_GET_COUNTER(huart->hdmarx));
+	  UART_Frame_Discard(&controlFramer);
+	  controlRxStart();
+	}
+
+	// UI channel number (0..NUM_CHANNELS-1 or MASTER_CHANNEL) to fader index, -1 if unknown
+	int faderIndex(int channel) {
+		if (channel >= 0 && channel < NUM_CHANNELS) {
+		  return channel;
+		}
+		return (channel == MASTER_CHANNEL) ? FADER_MASTER : -1;
+	}
+
+	// Retarget a fader's smoother. The audio path ramps to the new gain, so fader moves can be
+	// streamed without zipper noise.
+	void controlApplyFader(int fader) {
+		float gain = faderMuted[fader] ? 0.0f : IFX_VolumeToLinear(faderVolume[fader]);
+		IFX_ParamSmoother_SetTarget((fader == FADER_MASTER) ? &masterGain : &chGain[fader], gain);
+	}
+
+	void controlSetFader(int channel, int volume) {
+		int fader = faderIndex(channel);
+
+		if (fader >= 0) {
+		  faderVolume[fader] = (volume < 0) ? 0 : (volume > 100) ? 100 : volume;
+		  controlApplyFader(fader);
+		}
+	}
+
+	void controlSetMute(int channel, int on) {
+		int fader = faderIndex(channel);
+
+		if (fader >= 0) {
+		  faderMuted[fader] = (on != 0);
+		  controlApplyFader(fader);
+		}
+	}
+
+	void controlSetEqBand(int channel, int band, int freq, float gain_dB, float q) {
+		if (channel >= 0 && channel < NUM_CHANNELS && band >= 0 && band < NUM_EQ_BANDS && freq > 0 && q > 0.0f) {
+		  IFX_BiquadCascade_SetPeaking(&eqBank[channel], band, freq, q, IFX_DbToLinear(gain_dB));
+		}
+	}
+
+	// Apply one control frame (filterTask). Parameters reach the audio path through the IFX
+	// publish/latch mechanisms (EQ coefficient banks, smoother targets, overdrive requests), so
+	// nothing here waits on or locks out processData. A command is only applied when sscanf matched
+	// all of its required fields, so a truncated or garbled line changes nothing.
+	void controlParse(const char *cmd) {
+		if (cmd[0] == 'f') {
 		  // f, #CH, #FILTRO, FREQ, GAIN, Q
-		  if (channel == 0) {
-			if (filter == 0) {
-			  IFX_PeakingFilter_SetParameters(&filt1, newParams.centerFrequency, newParams.qFactor, newParams.gain);
-			} else if (filter == 1) {
-			  IFX_PeakingFilter_SetParameters(&filt2, newParams.centerFrequency, newParams.qFactor, newParams.gain);
-			} else if (filter == 2) {
-			  IFX_PeakingFilter_SetParameters(&filt3, newParams.centerFrequency, newParams.qFactor, newParams.gain);
+		  int channel = 0, filter = 0, freq = 0;
+		  float gain = 0.0f, qFactor = 0.0f;
+		  if (sscanf(cmd, "%*c,%d,%d,%d,%f,%f", &channel, &filter, &freq, &gain, &qFactor) == 5) {
+			controlSetEqBand(channel, filter, freq, gain, qFactor);
+
+			UART_Printf("CH: %d\n\r#F: %d\n\rCF: %d \n\rQ: %.5f \n\rGain: %.5f \n\r", channel, filter, freq, qFactor, gain);
+		  }
+
+		} else if (cmd[0] == 'b') {
+		  runBench();
+
+		} else if (cmd[0] == 'l') {
+		  // l[, MODE]: list the latency modes, or switch to MODE (restarts the audio DMA)
+		  int mode = -1;
+		  if (sscanf(cmd, "%*c,%d", &mode) == 1 && mode >= 0 && mode < (int) ARRAY_LEN(latencyModes) && (uint32_t) mode != latencyMode) {
+			setLatencyMode(mode);
+		  }
+		  printLatencyModes();
+
+		} else if (cmd[0] == 't') {
+		  // t, POINT (0 off, 1 input, 2 post-EQ, 3 output), #CH (bus for output): stream that
+		  // signal as int16 on UART3. Console output goes out between two tap segments.
+		  int point = TAP_OFF, channel = 0;
+		  int fields = sscanf(cmd, "%*c,%d,%d", &point, &channel);
+
+		  int channels = (point == TAP_OUTPUT) ? NUM_OUTPUTS : NUM_CHANNELS;
+		  if (fields >= 1 && point == TAP_OFF) {
+			tapSelect = TAP_OFF << 8;
+		  } else if (fields == 2 && point > TAP_OFF && point <= TAP_OUTPUT && channel >= 0 && channel < channels) {
+			tapSelect = ((uint32_t) point << 8) | (uint32_t) channel;
+		  }
+
+		} else if (cmd[0] == 'p') {
+		  // p[, RESET]: print the DSP load, then clear it if RESET is 1
+		  int reset = 0;
+		  int fields = sscanf(cmd, "%*c,%d", &reset);
+
+		  printProfile();
+		  if (fields == 1 && reset == 1) {
+			dspProfile.resetRequest = 1;
+		  }
+
+		} else if (cmd[0] == 'o') {
+		  // o, #CH, ON, PRE-GAIN, OVERSAMPLING (1, 2 or 4, optional)
+		  int channel = 0, on = 0, oversampling = 0;
+		  float preGain = 0.0f;
+		  int fields = sscanf(cmd, "%*c,%d,%d,%f,%d", &channel, &on, &preGain, &oversampling);
+
+		  if (fields >= 3 && channel >= 0 && channel < NUM_CHANNELS) {
+			if (preGain > 0.0f) {
+			  IFX_Overdrive_SetPreGain(&chDrive[channel], preGain);
 			}
-		  } else if (channel == 1) {
-		    if (filter == 0) {
-		      IFX_PeakingFilter_SetParameters(&filt4, newParams.centerFrequency, newParams.qFactor, newParams.gain);
-			} else if (filter == 1) {
-		      IFX_PeakingFilter_SetParameters(&filt5, newParams.centerFrequency, newParams.qFactor, newParams.gain);
-			} else if (filter == 2) {
-			  IFX_PeakingFilter_SetParameters(&filt6, newParams.centerFrequency, newParams.qFactor, newParams.gain);
+			if (fields == 4 && oversampling > 0) {
+			  IFX_Overdrive_SetOversampling(&chDrive[channel], (oversampling > 4) ? 4 : oversampling);
 			}
+			chDriveOn[channel] = (on != 0);
 		  }
 
+		} else if (cmd[0] == 'v') {
+		  int volume = 0, channel = 0;
+		  if (sscanf(cmd, "%*c,%d,%d", &channel, &volume) == 2) {
+			controlSetFader(channel, volume);
 
-		  HAL_UART_Transmit(&huart3, (uint8_t*)printBuffer, strlen(printBuffer), HAL_MAX_DELAY);
+			UART_Printf("CH: %d \n\rV: %d \n\r", channel, volume);
+		  }
 
-		} else if (uartData[0] == 'v') {
-		  uint8_t volume = 0, channel = 0;
-		  sscanf(uartData, "%c,%d,%d", NULL, &channel, &volume);
+		} else if (cmd[0] == 'm') {
+		  // m, #CH, ON
+		  int channel = 0, on = 0;
+		  if (sscanf(cmd, "%*c,%d,%d", &channel, &on) == 2) {
+			controlSetMute(channel, on);
+		  }
+		}
+	}
 
-		  float normalizedVolume = volume / 100.0f;
-		  float volumeMultiplier = powf(10.0f, (normalizedVolume - 1.0f) * 20.0f / 10.0f);
+	// CTRL_Link_Decode handler: one update from a binary frame
+	void controlLinkMsg(const CTRL_LinkMsg *msg, void *ctx) {
+		(void) ctx;
+
+		if (msg->type == CTRL_MSG_VOLUME) {
+		  controlSetFader(msg->ch, msg->value);
+		} else if (msg->type == CTRL_MSG_EQ_BAND) {
+		  controlSetEqBand(msg->ch, msg->band, msg->freq_Hz, 0.01f * msg->gain_cdB, 0.001f * msg->q_milli);
+		} else if (msg->type == CTRL_MSG_MUTE) {
+		  controlSetMute(msg->ch, msg->value);
+		} else if (msg->type == CTRL_MSG_LINK_SETUP) {
+		  controlLinkSetup(msg->baud, msg->value);
+		} else if (msg->type == CTRL_MSG_LINK_PING) {
+		  controlLinkPing(msg->value);
+		}
+	}
 
-		  char printBuffer[64];
-		  snprintf(printBuffer, sizeof(printBuffer), "CH: %d \n\rV: %d \n\r", channel, volumeMultiplier);
-		  HAL_UART_Transmit(&huart3, (uint8_t*)printBuffer, strlen(printBuffer), HAL_MAX_DELAY);
+	// One queued frame (filterTask): binary frames are applied silently, console lines echo. Only a
+	// frame that passed its CRC shows the link rate works: line noise at the wrong rate makes lines too.
+	void controlApply(const ControlFrame *frame) {
+		if (!frame->binary) {
+		  controlParse((const char *) frame->data);
+		} else if (CTRL_Link_Decode(frame->data, frame->len, controlLinkMsg, NULL) != CTRL_LINK_OK) {
+		  controlLinkErrors++;
+		  return;
+		} else {
+		  linkLastRx = osKernelGetTickCount();
+		}
 
+		controlRxFrames++;
+	}
 
-		  if (channel == 0) {
-			  vch1 = volumeMultiplier;
-		  } else if (channel == 1) {
-			  vch2 = volumeMultiplier;
-		  } else if (channel == 9) {
-			  vmaster = volumeMultiplier;
-		  }
+	// Reprogram UART2 (filterTask): rate, RTS/CTS and FIFO, then restart the reception. The HAL
+	// reinit clears the FIFO settings, so they are set again as in MX_USART2_UART_Init. Bytes in
+	// flight are lost, the framer starts clean on the next frame.
+	HAL_StatusTypeDef controlLinkConfig(uint32_t baud, uint8_t flags) {
+		HAL_UART_AbortReceive(&huart2);
 
+		huart2.Init.BaudRate = baud;
+		huart2.Init.HwFlowCtl = (flags & CTRL_LINK_FLOW_RTS_CTS) ? UART_HWCONTROL_RTS_CTS : UART_HWCONTROL_NONE;
 
+		if (HAL_UART_Init(&huart2) != HAL_OK
+			|| HAL_UARTEx_SetTxFifoThreshold(&huart2, UART_TXFIFO_THRESHOLD_1_2) != HAL_OK
+			|| HAL_UARTEx_SetRxFifoThreshold(&huart2, UART_RXFIFO_THRESHOLD_1_2) != HAL_OK
+			|| HAL_UARTEx_EnableFifoMode(&huart2) != HAL_OK) {
+		  return HAL_ERROR;
 		}
-		HAL_UART_Receive_DMA(&huart2, uartData, sizeof(uartData));
+
+		linkBaud = baud;
+		linkFlags = flags & CTRL_LINK_FLOW_RTS_CTS;
+		UART_Frame_Reset(&controlFramer);
+
+		return controlRxStart();
 	}
 
-	void HAL_I2SEx_TxRxHalfCpltCallback(I2S_HandleTypeDef *hi2s) {
-	  inBufPtr = &adcData[0];
-	  outBufPtr = &dacData[0];
-	  memcpy(uartBuffer, dacData, sizeof(dacData));
+	// The USART2 kernel clock (D2 PCLK1) divides down to baud within 1 %, with 16x oversampling
+	int controlLinkBaudOk(uint32_t baud) {
+		uint32_t clock = HAL_RCC_GetPCLK1Freq();
+
+		if (baud < CTRL_LINK_BAUD_SAFE || baud > clock / 16) {
+		  return 0;
+		}
+
+		uint32_t div = (clock + baud / 2) / baud;
+		uint32_t actual = clock / div;
+		uint32_t error = (actual > baud) ? actual - baud : baud - actual;
+
+		return error <= baud / 100;
+	}
+
+	// Send one frame to the ESP32 at the current rate (filterTask). Blocks until it has left the
+	// shift register, so the rate can be changed right after.
+	void controlLinkSend(CTRL_LinkBatch *batch) {
+		uint8_t wire[CTRL_LINK_MAX_WIRE];
+		size_t n = CTRL_Link_BatchFinish(batch, wire);
+
+		if (HAL_UART_Transmit(&huart2, wire, n, LINK_TX_TIMEOUT_MS) != HAL_OK) {
+		  linkTxErrors++;
+		}
+	}
+
+	// LINK_SETUP: acknowledge at the current rate, then switch and wait for a ping at the new one.
+	// A rate the clock cannot make is refused with baud 0 and nothing changes.
+	void controlLinkSetup(uint32_t baud, uint8_t flags) {
+		CTRL_LinkBatch batch;
+		int ok = controlLinkBaudOk(baud);
+
+		flags &= CTRL_LINK_FLOW_RTS_CTS;
+
+		CTRL_Link_BatchInit(&batch);
+		CTRL_Link_AddLinkSetup(&batch, CTRL_MSG_LINK_ACK, ok ? baud : 0, ok ? flags : 0);
+		controlLinkSend(&batch);
+
+		if (!ok) {
+		  return;
+		}
+
+		if (controlLinkConfig(baud, flags) != HAL_OK) {
+		  controlLinkFallback();
+		  return;
+		}
 
-	  if(osSemaphoreRelease(i2sHalfFullHandle) == osOK) {
-		//UART_Printf("i2s half released..");
+		linkState = (baud == CTRL_LINK_BAUD_SAFE && flags == 0) ? LINK_STATE_SAFE : LINK_STATE_TRIAL;
+		linkLastRx = osKernelGetTickCount();
+	}
+
+	// LINK_PING: confirms a trial rate, answered with the receive counters
+	void controlLinkPing(uint8_t seq) {
+		CTRL_LinkBatch batch;
+		uint32_t errors = controlRxErrors + controlFramer.overflows + controlDrops + controlLinkErrors;
+
+		if (linkState == LINK_STATE_TRIAL) {
+		  linkState = LINK_STATE_UP;
+		}
+
+		CTRL_Link_BatchInit(&batch);
+		CTRL_Link_AddLinkStats(&batch, seq, controlRxBytes, controlRxFrames, errors);
+		controlLinkSend(&batch);
+	}
+
+	void controlLinkFallback(void) {
+		linkFallbacks++;
+		linkState = LINK_STATE_SAFE;
+
+		if (controlLinkConfig(CTRL_LINK_BAUD_SAFE, 0) != HAL_OK) {
+		  Error_Handler();
+		}
+	}
+
+	// filterTask, at least every CTRL_LINK_POLL_MS: give up a rate the ESP32 has stopped talking at,
+	// so a reset ESP32 (or a rate this wiring cannot carry) finds the link at the safe rate again
+	void controlLinkPoll(void) {
+		uint32_t quiet = osKernelGetTickCount() - linkLastRx;
+
+		if (linkState == LINK_STATE_SAFE) {
+		  return;
+		}
+
+		if ((linkState == LINK_STATE_TRIAL && quiet > CTRL_LINK_TRIAL_MS) || quiet > LINK_TIMEOUT_MS) {
+		  controlLinkFallback();
+		}
+	}
+
+	// Called from both I2S DMA callbacks (or the SAI one alone, with AUDIO_USE_SAI_TDM), which share
+	// an NVIC priority and so never nest. A half goes to the DSP task once both inputs have filled it;
+	// they run off the same CK and WS, so the second event follows the first within a frame. An input
+	// reporting the same half twice means the other one has stopped: count it and keep the running
+	// input going on its own.
+	void audioHalfReady(uint8_t half, uint8_t src) {
+	  uint8_t srcs = audioHalfSrcs[half];
+
+	  if (srcs & src) {
+		audioSyncErrors++;
 	  } else {
-		//UART_Printf("i2s failed..");
+		srcs |= src;
+		if (srcs != AUDIO_SRCS) {
+		  audioHalfSrcs[half] = srcs;
+		  return;
+		}
+		audioHalfSrcs[half] = 0;
 	  }
+
+	  IFX_Profiler_DmaEvent(&dspProfile);
+	  osThreadFlagsSet(processDataHandle, AUDIO_FLAG_HALF(half));
 	  dataReadyFlag = 1;
 	}
 
-	void HAL_I2SEx_TxRxCpltCallback(I2S_HandleTypeDef *hi2s) {
-	  inBufPtr = &adcData[BUFFER_SIZE];
-	  outBufPtr = &dacData[BUFFER_SIZE];
-	  memcpy(uartBuffer, dacData, sizeof(dacData));
+	// Audio tap segment sent: start the next one, or go idle if the ring is empty or a console print
+	// is waiting for the UART
+	void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart) {
+	  if (huart->Instance == USART3 && tapSending != 0) {
+		tapTail += tapSending;
+		if (consoleWaiting) {
+		  tapSending = 0;
+		  osSemaphoreRelease(uartFullHandle);
+		} else {
+		  tapSend();
+		}
+	  }
+	}
+
+	// Start the UART3 DMA on the next contiguous run of tapRing. Called with the DMA idle: from the
+	// DSP task when tapSending is 0, or from the transfer complete callback.
+	void tapSend(void) {
+	  uint32_t tail = tapTail;
+	  uint32_t index = tail % TAP_RING_SAMPLES;
+	  uint32_t count = tapHead - tail;
+
+	  if (count > TAP_RING_SAMPLES - index) {
+		count = TAP_RING_SAMPLES - index;
+	  }
+	  if (count > TAP_SEGMENT_SAMPLES) {
+		count = TAP_SEGMENT_SAMPLES;
+	  }
+
+	  tapSending = count;
+	  if (count != 0 && HAL_UART_Transmit_DMA(&huart3, (uint8_t *) &tapRing[index], count * sizeof(int16_t)) != HAL_OK) {
+		// UART3 not ready: retried on the next block
+		tapSending = 0;
+	  }
+	}
+
+	// Two consecutive samples per packed 32-bit store. Block sizes and the ring size are even, so the
+	// head index stays even and out is word aligned; the scalar path only covers an odd tail or start.
+	DSP_FAST_CODE void tapConvert(const float *buf, int16_t *out, uint32_t n) {
+	  if (((uintptr_t) out & 3u) != 0) {
+		IFX_FloatToInt16(buf, out, 1, n);
+		return;
+	  }
 
-	  if(osSemaphoreRelease(i2sHalfFullHandle) == osOK) {
-		//UART_Printf("i2s full released..");
+	  IFX_FloatToInt16Stereo(buf, buf + 1, 2, (int32_t *) out, n / 2);
+	  if ((n & 1u) != 0) {
+		IFX_FloatToInt16(buf + n - 1, out + n - 1, 1, 1);
+	  }
+	}
+
+	// DSP task: convert one block into tapRing (saturated int16) and make sure the DMA is running.
+	// A block that does not fit is dropped whole.
+	DSP_FAST_CODE void tapWrite(const float *buf, uint32_t frames) {
+	  uint32_t head = tapHead;
+	  uint32_t index = head % TAP_RING_SAMPLES;
+	  uint32_t first = TAP_RING_SAMPLES - index;
+
+	  if (head - tapTail + frames > TAP_RING_SAMPLES) {
+		tapDrops++;
+		return;
+	  }
+
+	  if (first >= frames) {
+		tapConvert(buf, &tapRing[index], frames);
 	  } else {
-		//UART_Printf("i2s failed..");
+		tapConvert(buf, &tapRing[index], first);
+		tapConvert(buf + first, tapRing, frames - first);
+	  }
+
+	  // Samples must be in RAM before the DMA can be pointed at them
+	  __DMB();
+	  tapHead = head + frames;
+
+	  if (tapSending == 0 && !consoleWaiting) {
+		tapSend();
 	  }
-	  dataReadyFlag = 1;
 	}
 
-	void processData() {
-	  static float leftIn, leftProcessed, leftProcessed2, leftOut;
-	  static float rightIn, rightProcessed, rightProcessed2, rightOut;
+	// I2S3 DMA is now working on the second half, the first one is ready
+	void HAL_I2SEx_TxRxHalfCpltCallback(I2S_HandleTypeDef *hi2s) {
+	  audioHalfReady(0, AUDIO_SRC_I2S3);
+	}
 
-	  for (uint8_t n = 0; n < (BUFFER_SIZE) - 1; n+=4) {
-		// LEFT
+	// I2S3 DMA wrapped to the first half, the second one is ready
+	void HAL_I2SEx_TxRxCpltCallback(I2S_HandleTypeDef *hi2s) {
+	  audioHalfReady(1, AUDIO_SRC_I2S3);
+	}
 
-		//  CONVERTIR ENTRADA ADC A FLOAT
-		leftIn = INT16_TO_FLOAT(inBufPtr[n]);
-		if (leftIn > 1.0f) {
-		  leftIn -= 2.0f;
-		}
+	// Same for the I2S1 receive DMA (CH3 & CH4)
+	void HAL_I2S_RxHalfCpltCallback(I2S_HandleTypeDef *hi2s) {
+	  if (hi2s->Instance == SPI1) {
+		audioHalfReady(0, AUDIO_SRC_I2S1);
+	  }
+	}
+
+	void HAL_I2S_RxCpltCallback(I2S_HandleTypeDef *hi2s) {
+	  if (hi2s->Instance == SPI1) {
+		audioHalfReady(1, AUDIO_SRC_I2S1);
+	  }
+	}
+
+	#if AUDIO_USE_SAI_TDM
+	// SAI1 receive DMA filled half 0 or 1 of adcData; transmit is on the other half of dacData
+	void SAI_TDM_HalfCpltCallback(uint8_t half) {
+	  audioHalfReady(half, AUDIO_SRC_SAI);
+	}
+	#endif
+
+	// Process one half (0 or 1) of every input link into the same half of dacData, in three phases:
+	// deinterleave into chBuf, run each stage over whole planar blocks, reinterleave busBuf
+	DSP_FAST_CODE void processData(uint8_t half) {
+	  const uint32_t frames = audioBlockFrames;
+	  int32_t *outBufPtr = &dacData[half * frames * AUDIO_OUT_SLOTS];
 
-		leftProcessed = IFX_PeakingFilter_Update(&filt1, leftIn);
+	  IFX_Profiler_BlockBegin(&dspProfile);
 
-		leftProcessed = IFX_PeakingFilter_Update(&filt2, leftProcessed);
+	  float gStart, gEnd, mStart, mEnd;
 
-		leftProcessed = IFX_PeakingFilter_Update(&filt3, leftProcessed);
+	  // Tap point and channel for this block
+	  const uint32_t tap = tapSelect;
+	  const uint8_t tapPoint = tap >> 8;
+	  const uint8_t tapCh = tap & 0xFF;
 
-		// OUTPUT LEFT
-		leftOut = leftProcessed * vch1 * vmaster;
+	  //  CONVERTIR ENTRADA ADC A FLOAT, one pass per link
+	  uint8_t first = 0;
+	  for (uint32_t n = 0; n < ARRAY_LEN(audioInputs); n++) {
+		const AudioLink *link = &audioInputs[n];
+		const int32_t *in = &link->buf[half * frames * link->slots];
 
-		// CONVERTIR SALIDA DAC A SIGNED INT
-		outBufPtr[n] = (int16_t) (FLOAT_TO_INT16(leftOut));
-		outBufPtr[n+1] = 0;//(int16_t) (FLOAT_TO_INT16(leftOut));
-		// RIGHT
+	#if AUDIO_BUFFERS_CACHEABLE
+		// Drop any stale lines of the half the DMA just filled
+		SCB_InvalidateDCache_by_Addr((void *) in, frames * link->slots * sizeof(int32_t));
+	#endif
+		IFX_Int24ToFloatPlanar(in, link->slots, &chPtr[first], frames);
+		first += link->slots;
+	  }
+	  if (tapPoint == TAP_INPUT) {
+		tapWrite(chBuf[tapCh], frames);
+	  }
+	  IFX_Profiler_StageEnd(&dspProfile, PROF_STAGE_INPUT);
+
+	  // EQ, one cascade per channel
+	  for (uint8_t ch = 0; ch < NUM_CHANNELS; ch++) {
+		IFX_BiquadCascade_ProcessBlock(&eqBank[ch], chBuf[ch], chBuf[ch], frames);
+	  }
+	  if (tapPoint == TAP_EQ) {
+		tapWrite(chBuf[tapCh], frames);
+	  }
+	  IFX_Profiler_StageEnd(&dspProfile, PROF_STAGE_EQ);
 
-		//  CONVERTIR ENTRADA ADC A FLOAT
-		rightIn = INT16_TO_FLOAT(inBufPtr[n+2]);
-		if (rightIn > 1.0f) {
-		  rightIn -= 2.0f;
+	  // OVERDRIVE insert
+	  for (uint8_t ch = 0; ch < NUM_CHANNELS; ch++) {
+		if (chDriveOn[ch]) {
+		  IFX_Overdrive_ProcessBlock(&chDrive[ch], chBuf[ch], chBuf[ch], frames);
+		}
+	  }
+	  IFX_Profiler_StageEnd(&dspProfile, PROF_STAGE_DRIVE);
+
+	  // GAIN, channel fader times master, ramped over the block and summed onto the channel's bus
+	  // (the first channel of each bus overwrites it)
+	  mEnd = IFX_ParamSmoother_Step(&masterGain, &mStart);
+	  for (uint8_t ch = 0; ch < NUM_CHANNELS; ch++) {
+		gEnd = IFX_ParamSmoother_Step(&chGain[ch], &gStart);
+		if (ch < NUM_OUTPUTS) {
+		  IFX_ApplyGainRamp(chBuf[ch], busBuf[ch], frames, gStart * mStart, gEnd * mEnd);
+		} else {
+		  IFX_MixGainRamp(chBuf[ch], busBuf[ch % NUM_OUTPUTS], frames, gStart * mStart, gEnd * mEnd);
 		}
+	  }
+	  if (tapPoint == TAP_OUTPUT) {
+		tapWrite(busBuf[tapCh], frames);
+	  }
+	  IFX_Profiler_StageEnd(&dspProfile, PROF_STAGE_GAIN);
 
-		rightProcessed = IFX_PeakingFilter_Update(&filt1, rightIn);
+	  // CONVERTIR SALIDA DAC A SIGNED INT (24-bit, saturated), one pass
+	  IFX_FloatPlanarToInt24(busPtr, AUDIO_OUT_SLOTS, outBufPtr, frames);
+	#if AUDIO_BUFFERS_CACHEABLE
+	  // Write the half back to RAM before the DMA comes round to it
+	  SCB_CleanDCache_by_Addr((uint32_t *) outBufPtr, frames * AUDIO_OUT_SLOTS * sizeof(int32_t));
+	#endif
+	  IFX_Profiler_StageEnd(&dspProfile, PROF_STAGE_OUTPUT);
 
-		rightProcessed = IFX_PeakingFilter_Update(&filt2, rightProcessed);
+	  IFX_Profiler_BlockEnd(&dspProfile);
 
-		rightProcessed = IFX_PeakingFilter_Update(&filt3, rightProcessed);
+		dataReadyFlag = 0;
+	}
 
-		// OUTPUT RIGHT
-		rightOut = rightProcessed * vch2 * vmaster;
+	// Configure the audio path for a latency mode and start both I2S DMAs (or the SAI TDM link). The
+	// DMAs must be stopped.
+	HAL_StatusTypeDef startAudio(uint32_t mode) {
+	  uint32_t frames = latencyModes[mode].frames;
+	  float blocksPerMs = SAMPLE_RATE_HZ / (1000.0f * frames);
 
-		// CONVERTIR SALIDA DAC A SIGNED INT
-		outBufPtr[n+2] = (int16_t) (FLOAT_TO_INT16(rightOut));
-		outBufPtr[n+3] = 0;
+	#if AUDIO_USE_SAI_TDM
+	  if (frames > AUDIO_TDM_BLOCK_MAX) {
+		return HAL_ERROR;
 	  }
 
-		dataReadyFlag = 0;
+	  for (uint32_t slot = 0; slot < SAI_TDM_SLOTS; slot++) {
+		chPtr[slot] = (slot < NUM_CHANNELS) ? chBuf[slot] : tdmDiscard;
+		busPtr[slot] = (slot < NUM_OUTPUTS) ? busBuf[slot] : tdmSilence;
+	  }
+	#endif
+
+	  latencyMode = mode;
+	  audioBlockFrames = frames;
+
+	  // Keep the smoothing times in ms whatever the block size
+	  for (uint8_t ch = 0; ch < NUM_CHANNELS; ch++) {
+		IFX_BiquadCascade_SetSmoothing(&eqBank[ch], (uint32_t) (EQ_SMOOTH_MS * blocksPerMs + 0.5f));
+		IFX_ParamSmoother_SetBlocks(&chGain[ch], (uint32_t) (GAIN_SMOOTH_MS * blocksPerMs + 0.5f));
+	  }
+	  IFX_ParamSmoother_SetBlocks(&masterGain, (uint32_t) (GAIN_SMOOTH_MS * blocksPerMs + 0.5f));
+
+	  // Budget: one half buffer period at the core clock
+	  IFX_Profiler_SetBudget(&dspProfile, (uint32_t) (IFX_CYCLES_PER_SECOND * frames / SAMPLE_RATE_HZ));
+
+	  memset(dacData, 0, sizeof(dacData));
+	#if AUDIO_BUFFERS_CACHEABLE
+	  SCB_CleanDCache_by_Addr((uint32_t *) dacData, sizeof(dacData));
+	#endif
+	  audioHalfSrcs[0] = 0;
+	  audioHalfSrcs[1] = 0;
+
+	#if AUDIO_USE_SAI_TDM
+	  return SAI_TDM_Start(dacData, adcData, frames);
+	#else
+	  // Size counts 32-bit slots over both halves: 2 halves * frames * 2 slots (the HAL takes uint16_t *
+	  // but the DMA streams move words). I2S1 is armed first and waits for the master's clocks, so both
+	  // start on the same frame and their half/full events stay in step.
+	  if (HAL_I2S_Receive_DMA(&hi2s1, (uint16_t *) adcData2, frames * 4) != HAL_OK) {
+		return HAL_ERROR;
+	  }
+	  return HAL_I2SEx_TransmitReceive_DMA(&hi2s3, (uint16_t *) dacData, (uint16_t *) adcData, frames * 4);
+	#endif
+	}
+
+	// With AUDIO_BUFFERS_CACHEABLE, lay a write-back cacheable region over the I2S buffer half of
+	// MPU region 0 (higher region numbers win where they overlap); the UART buffers above it stay
+	// non-cacheable. Cache maintenance works on 32-byte lines, so every half buffer must start and
+	// end on a line: block sizes are multiples of 4 frames.
+	void MPU_ConfigAudioBuffers(void) {
+	#if AUDIO_BUFFERS_CACHEABLE
+	  MPU_Region_InitTypeDef MPU_InitStruct = {0};
+
+	  HAL_MPU_Disable();
+
+	  MPU_InitStruct.Enable = MPU_REGION_ENABLE;
+	  MPU_InitStruct.Number = MPU_REGION_NUMBER1;
+	  MPU_InitStruct.BaseAddress = 0x30010000;
+	  MPU_InitStruct.Size = MPU_REGION_SIZE_32KB;
+	  MPU_InitStruct.SubRegionDisable = 0x0;
+	  MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL1;
+	  MPU_InitStruct.AccessPermission = MPU_REGION_FULL_ACCESS;
+	  MPU_InitStruct.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
+	  MPU_InitStruct.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+	  MPU_InitStruct.IsCacheable = MPU_ACCESS_CACHEABLE;
+	  MPU_InitStruct.IsBufferable = MPU_ACCESS_BUFFERABLE;
+
+	  HAL_MPU_ConfigRegion(&MPU_InitStruct);
+	  HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+	#endif
+	}
+
+	// Control side: stop the audio DMAs, switch block size and restart. Output is muted for the
+	// few blocks this takes.
+	void setLatencyMode(uint32_t mode) {
+	#if AUDIO_USE_SAI_TDM
+	  // Refuse before stopping: a block that does not fit the TDM buffers would leave audio off
+	  if (latencyModes[mode].frames > AUDIO_TDM_BLOCK_MAX) {
+		UART_Printf("Block longer than %u frames at %u TDM slots\r\n", (unsigned) AUDIO_TDM_BLOCK_MAX, (unsigned) SAI_TDM_SLOTS);
+		return;
+	  }
+
+	  if (SAI_TDM_Stop() != HAL_OK) {
+		UART_Printf("SAI TDM stop failed\r\n");
+		return;
+	  }
+	#else
+	  // Master first, so the slave sees its clocks stop between frames
+	  if (HAL_I2S_DMAStop(&hi2s3) != HAL_OK || HAL_I2S_DMAStop(&hi2s1) != HAL_OK) {
+		UART_Printf("I2S DMA stop failed\r\n");
+		return;
+	  }
+	#endif
+
+	  if (startAudio(mode) != HAL_OK) {
+		UART_Printf("Audio DMA restart failed\r\n");
+		return;
+	  }
+	}
+
+	void printLatencyModes(void) {
+	  UART_Printf("mode  name          block   block ms   in->out ms\r\n");
+	  for (uint32_t n = 0; n < ARRAY_LEN(latencyModes); n++) {
+		float blockMs = 1000.0f * latencyModes[n].frames / SAMPLE_RATE_HZ;
+
+		UART_Printf("%c%-4lu %-12s %6lu %10.3f %12.3f\r\n", (n == latencyMode) ? '*' : ' ', (unsigned long) n, latencyModes[n].name,
+					(unsigned long) latencyModes[n].frames, blockMs, 2.0f * blockMs);
+	  }
+	}
+
+	// Control side: print dspProfile over UART3, from a copy taken with the DSP task held off
+	void printProfile(void) {
+	  IFX_Profiler *prof = &dspProfileCopy;
+
+	  osKernelLock();
+	  memcpy(prof, &dspProfile, sizeof(IFX_Profiler));
+	  osKernelUnlock();
+
+	  float toPct = 100.0f / (float) prof->budget;
+
+	  UART_Printf("stage        min cyc   avg cyc   max cyc   avg %%   max %%  (budget %lu cyc)\r\n", (unsigned long) prof->budget);
+	  for (uint32_t n = 0; n <= prof->numStages; n++) {
+		const IFX_ProfilerStat *stat = (n < prof->numStages) ? &prof->stage[n] : &prof->block;
+		const char *name = (n < prof->numStages) ? prof->stageName[n] : "block";
+		uint32_t min = (stat->count == 0) ? 0 : stat->min;
+		uint32_t avg = IFX_Profiler_Average(stat);
+
+		UART_Printf("%-10s %9lu %9lu %9lu %7.2f %7.2f\r\n", name, (unsigned long) min, (unsigned long) avg, (unsigned long) stat->max, avg * toPct, stat->max * toPct);
+	  }
+
+	  UART_Printf("blocks: %lu  xruns: %lu  sync errors: %lu  tap drops: %lu\r\n", (unsigned long) prof->block.count, (unsigned long) prof->xruns,
+				  (unsigned long) audioSyncErrors, (unsigned long) tapDrops);
+	#if AUDIO_USE_SAI_TDM
+	  UART_Printf("SAI TDM errors: %lu\r\n", (unsigned long) SAI_TDM_GetErrors());
+	#endif
+	  UART_Printf("control frames dropped: %lu  too long: %lu  rx errors: %lu  bad packets: %lu\r\n", (unsigned long) controlDrops,
+				  (unsigned long) controlFramer.overflows, (unsigned long) controlRxErrors, (unsigned long) controlLinkErrors);
+	  printLink();
+
+	  UART_Printf("load %%:");
+	  for (uint32_t n = 0; n < IFX_PROFILER_HIST_BINS - 1; n++) {
+		UART_Printf(" <%lu:%lu", (unsigned long) ((n + 1) * 10), (unsigned long) prof->hist[n]);
+	  }
+	  UART_Printf(" >=100:%lu\r\n", (unsigned long) prof->hist[IFX_PROFILER_HIST_BINS - 1]);
+	}
+
+	// Control side: UART2 rate and throughput since the previous report
+	void printLink(void) {
+	  static const char *const stateName[] = { "safe", "trial", "up" };
+	  uint32_t now = osKernelGetTickCount();
+	  uint32_t bytes = controlRxBytes;
+	  uint32_t ms = now - linkReportTick;
+	  uint32_t rate = (ms == 0) ? 0 : (uint32_t) ((uint64_t) (bytes - linkReportBytes) * 1000U / ms);
+
+	  UART_Printf("link: %lu baud %s (%s)  rx bytes: %lu (%lu B/s)  frames: %lu  fallbacks: %lu  tx errors: %lu\r\n", (unsigned long) linkBaud,
+				  (linkFlags & CTRL_LINK_FLOW_RTS_CTS) ? "RTS/CTS" : "no flow control", stateName[linkState], (unsigned long) bytes,
+				  (unsigned long) rate, (unsigned long) controlRxFrames, (unsigned long) linkFallbacks, (unsigned long) linkTxErrors);
+
+	  linkReportBytes = bytes;
+	  linkReportTick = now;
+	}
+
+	// Control side: run the kernel benchmarks and print them over UART3
+	void runBench(void) {
+	  IFX_BenchResult *results = benchResults;
+	  uint32_t count = IFX_Bench_RunAll(results, IFX_BENCH_MAX_RESULTS, SAMPLE_RATE_HZ);
+
+	  UART_Printf("kernel          cyc/item   ns/item  headroom\r\n");
+	  for (uint32_t k = 0; k < count; k++) {
+		if (results[k].perSample) {
+		  UART_Printf("%-14s %9.2f %9.2f %8.2f%%\r\n", results[k].name, results[k].cyclesPerItem, results[k].nsPerItem, results[k].headroomPct);
+		} else {
+		  UART_Printf("%-14s %9.2f %9.2f        -\r\n", results[k].name, results[k].cyclesPerItem, results[k].nsPerItem);
+		}
+	  }
 	}
 /* USER CODE END 4 */
 
@@ -811,12 +1656,23 @@ static void MX_GPIO_Init(void)
 void setFilterTask(void *argument)
 {
   /* USER CODE BEGIN 5 */
+	  // Armed here rather than in main() so every line finds uartQueue created
+	  UART_Frame_Init(&controlFramer, controlLineReady, controlPacketReady);
+	  if (controlRxStart() != HAL_OK) {
+		UART_Printf("UART DMA Receive initialization failed\n");
+		Error_Handler();
+	  }
+
+	  ControlFrame frame;
+
 	  /* Infinite loop */
 	  for(;;)
 	  {
-
-		osThreadYield();
-		//IFX_PeakingFilter_SetParameters(&filt1, 1000.0f, hz, 0.0f);
+		// Sleep until the UART callbacks queue a line or packet, waking to check the link timeouts
+		if (osMessageQueueGet(uartQueueHandle, &frame, NULL, CTRL_LINK_POLL_MS) == osOK) {
+		  controlApply(&frame);
+		}
+		controlLinkPoll();
 	  }
   /* USER CODE END 5 */
 }
@@ -834,20 +1690,19 @@ void processDataTask(void *argument)
 	  /* Infinite loop */
 	  for(;;)
 	  {
-		if (osSemaphoreAcquire(i2sHalfFullHandle, 0) == osOK) {
-		  processData();
-		}
+		// Block until a DMA callback hands over a buffer half, the idle task gets the rest
+		uint32_t flags = osThreadFlagsWait(AUDIO_FLAGS, osFlagsWaitAny, osWaitForever);
 
-		if (osSemaphoreAcquire(i2sHalfFullHandle, 0) == osOK) {
-		  processData();
+		if (flags & osFlagsError) {
+		  continue;
 		}
 
-
-//		if (osSemaphoreAcquire(i2sFullHandle, 0) == osOK) {
-//		  processData();
-//		}
-
-		osThreadYield();
+		// Both bits set means a half was missed; run both so the filters stay continuous
+		for (uint8_t half = 0; half < 2; half++) {
+		  if (flags & AUDIO_FLAG_HALF(half)) {
+			processData(half);
+		  }
+		}
 
 	  }
   /* USER CODE END processDataTask */
@@ -5,8 +5,17 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
+../Core/Src/IFX_Bench.c \
+../Core/Src/IFX_BiquadCascade.c \
+../Core/Src/IFX_CoefDesign.c \
+../Core/Src/IFX_FIR.c \
 ../Core/Src/IFX_Overdrive.c \
+../Core/Src/IFX_ParamSmoother.c \
 ../Core/Src/IFX_PeakingFilter.c \
+../Core/Src/IFX_Profiler.c \
+../Core/Src/IFX_SampleConvert.c \
+../Core/Src/SAI_TDM.c \
+../Core/Src/UART_Frame.c \
 ../Core/Src/freertos.c \
 ../Core/Src/main.c \
 ../Core/Src/stm32h7xx_hal_msp.c \
@@ -16,8 +25,17 @@ C_SRCS += \
 ../Core/Src/sysmem.c 
 
 OBJS += \
+./Core/Src/IFX_Bench.o \
+./Core/Src/IFX_BiquadCascade.o \
+./Core/Src/IFX_CoefDesign.o \
+./Core/Src/IFX_FIR.o \
 ./Core/Src/IFX_Overdrive.o \
+./Core/Src/IFX_ParamSmoother.o \
 ./Core/Src/IFX_PeakingFilter.o \
+./Core/Src/IFX_Profiler.o \
+./Core/Src/IFX_SampleConvert.o \
+./Core/Src/SAI_TDM.o \
+./Core/Src/UART_Frame.o \
 ./Core/Src/freertos.o \
 ./Core/Src/main.o \
 ./Core/Src/stm32h7xx_hal_msp.o \
@@ -27,8 +45,17 @@ OBJS += \
 ./Core/Src/sysmem.o 
 
 C_DEPS += \
+./Core/Src/IFX_Bench.d \
+./Core/Src/IFX_BiquadCascade.d \
+./Core/Src/IFX_CoefDesign.d \
+./Core/Src/IFX_FIR.d \
 ./Core/Src/IFX_Overdrive.d \
+./Core/Src/IFX_ParamSmoother.d \
 ./Core/Src/IFX_PeakingFilter.d \
+./Core/Src/IFX_Profiler.d \
+./Core/Src/IFX_SampleConvert.d \
+./Core/Src/SAI_TDM.d \
+./Core/Src/UART_Frame.d \
 ./Core/Src/freertos.d \
 ./Core/Src/main.d \
 ./Core/Src/stm32h7xx_hal_msp.d \
@@ -40,12 +67,12 @@ C_DEPS += \
 
 # Each subdirectory must supply rules for building sources it contributes
 Core/Src/%.o Core/Src/%.su Core/Src/%.cyclo: ../Core/Src/%.c Core/Src/subdir.mk
-	arm-none-eabi-gcc "$<" -mcpu=cortex-m7 -std=gnu11 -g3 -DDEBUG -DCORE_CM7 -DUSE_HAL_DRIVER -DSTM32H745xx -c -I../Core/Inc -I../../Drivers/STM32H7xx_HAL_Driver/Inc -I../../Drivers/STM32H7xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32H7xx/Include -I../../Drivers/CMSIS/Include -I../../Middlewares/Third_Party/FreeRTOS/Source/include -I../../Middlewares/Third_Party/FreeRTOS/Source/portable/GCC/ARM_CM4F -I../../Middlewares/Third_Party/FreeRTOS/Source/CMSIS_RTOS_V2 -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv5-d16 -mfloat-abi=hard -mthumb -o "$@"
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m7 -std=gnu11 -g3 -DDEBUG -DCORE_CM7 -DUSE_HAL_DRIVER -DSTM32H745xx -c -I../Core/Inc -I../../Drivers/STM32H7xx_HAL_Driver/Inc -I../../Drivers/STM32H7xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32H7xx/Include -I../../Drivers/CMSIS/Include -I../../Middlewares/Third_Party/FreeRTOS/Source/include -I../../Middlewares/Third_Party/FreeRTOS/Source/portable/GCC/ARM_CM4F -I../../Middlewares/Third_Party/FreeRTOS/Source/CMSIS_RTOS_V2 -I../../../../ESP32/server/src -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv5-d16 -mfloat-abi=hard -mthumb -o "$@"
 
 clean: clean-Core-2f-Src
 
 clean-Core-2f-Src:
-	-$(RM) ./Core/Src/IFX_Overdrive.cyclo ./Core/Src/IFX_Overdrive.d ./Core/Src/IFX_Overdrive.o ./Core/Src/IFX_Overdrive.su ./Core/Src/IFX_PeakingFilter.cyclo ./Core/Src/IFX_PeakingFilter.d ./Core/Src/IFX_PeakingFilter.o ./Core/Src/IFX_PeakingFilter.su ./Core/Src/freertos.cyclo ./Core/Src/freertos.d ./Core/Src/freertos.o ./Core/Src/freertos.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/stm32h7xx_hal_msp.cyclo ./Core/Src/stm32h7xx_hal_msp.d ./Core/Src/stm32h7xx_hal_msp.o ./Core/Src/stm32h7xx_hal_msp.su ./Core/Src/stm32h7xx_hal_timebase_tim.cyclo ./Core/Src/stm32h7xx_hal_timebase_tim.d ./Core/Src/stm32h7xx_hal_timebase_tim.o ./Core/Src/stm32h7xx_hal_timebase_tim.su ./Core/Src/stm32h7xx_it.cyclo ./Core/Src/stm32h7xx_it.d ./Core/Src/stm32h7xx_it.o ./Core/Src/stm32h7xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su
+	-$(RM) ./Core/Src/IFX_Bench.cyclo ./Core/Src/IFX_Bench.d ./Core/Src/IFX_Bench.o ./Core/Src/IFX_Bench.su ./Core/Src/IFX_BiquadCascade.cyclo ./Core/Src/IFX_BiquadCascade.d ./Core/Src/IFX_BiquadCascade.o ./Core/Src/IFX_BiquadCascade.su ./Core/Src/IFX_CoefDesign.cyclo ./Core/Src/IFX_CoefDesign.d ./Core/Src/IFX_CoefDesign.o ./Core/Src/IFX_CoefDesign.su ./Core/Src/IFX_FIR.cyclo ./Core/Src/IFX_FIR.d ./Core/Src/IFX_FIR.o ./Core/Src/IFX_FIR.su ./Core/Src/IFX_Overdrive.cyclo ./Core/Src/IFX_Overdrive.d ./Core/Src/IFX_Overdrive.o ./Core/Src/IFX_Overdrive.su ./Core/Src/IFX_ParamSmoother.cyclo ./Core/Src/IFX_ParamSmoother.d ./Core/Src/IFX_ParamSmoother.o ./Core/Src/IFX_ParamSmoother.su ./Core/Src/IFX_PeakingFilter.cyclo ./Core/Src/IFX_PeakingFilter.d ./Core/Src/IFX_PeakingFilter.o ./Core/Src/IFX_PeakingFilter.su ./Core/Src/IFX_Profiler.cyclo ./Core/Src/IFX_Profiler.d ./Core/Src/IFX_Profiler.o ./Core/Src/IFX_Profiler.su ./Core/Src/IFX_SampleConvert.cyclo ./Core/Src/IFX_SampleConvert.d ./Core/Src/IFX_SampleConvert.o ./Core/Src/IFX_SampleConvert.su ./Core/Src/SAI_TDM.cyclo ./Core/Src/SAI_TDM.d ./Core/Src/SAI_TDM.o ./Core/Src/SAI_TDM.su ./Core/Src/UART_Frame.cyclo ./Core/Src/UART_Frame.d ./Core/Src/UART_Frame.o ./Core/Src/UART_Frame.su ./Core/Src/freertos.cyclo ./Core/Src/freertos.d ./Core/Src/freertos.o ./Core/Src/freertos.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/stm32h7xx_hal_msp.cyclo ./Core/Src/stm32h7xx_hal_msp.d ./Core/Src/stm32h7xx_hal_msp.o ./Core/Src/stm32h7xx_hal_msp.su ./Core/Src/stm32h7xx_hal_timebase_tim.cyclo ./Core/Src/stm32h7xx_hal_timebase_tim.d ./Core/Src/stm32h7xx_hal_timebase_tim.o ./Core/Src/stm32h7xx_hal_timebase_tim.su ./Core/Src/stm32h7xx_it.cyclo ./Core/Src/stm32h7xx_it.d ./Core/Src/stm32h7xx_it.o ./Core/Src/stm32h7xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su
 
 .PHONY: clean-Core-2f-Src
 
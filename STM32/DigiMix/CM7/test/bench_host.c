@@ -0,0 +1,35 @@
+/*
+ * bench_host.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// Host run of the kernels timed by the 'b' console command, same table as on the board. Timing
+// comes from CLOCK_MONOTONIC, so numbers are in host nanoseconds and only useful to compare kernels
+// or two versions of one kernel on the same machine:
+//
+//   build/bench_host [sample rate, default 48000]
+
+#include "IFX_Bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+
+	float sampleRate_Hz = (argc > 1) ? (float) atof(argv[1]) : 48000.0f;
+
+	static IFX_BenchResult results[IFX_BENCH_MAX_RESULTS];
+	uint32_t count = IFX_Bench_RunAll(results, IFX_BENCH_MAX_RESULTS, sampleRate_Hz);
+
+	printf("kernel          ns/sample  ns/call\n");
+	for (uint32_t k = 0; k < count; k++) {
+		if (results[k].perSample) {
+			printf("%-14s %10.2f        -\n", results[k].name, results[k].nsPerItem);
+		} else {
+			printf("%-14s          - %8.2f\n", results[k].name, results[k].nsPerItem);
+		}
+	}
+
+	return 0;
+}
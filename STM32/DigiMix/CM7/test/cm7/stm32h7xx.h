@@ -0,0 +1,34 @@
+/*
+ * stm32h7xx.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// Host stand-in for the device header, for test_convert_cm7 only: plain C versions of the CMSIS
+// intrinsics used by the CORE_CM7 paths of the IFX modules, with the Arm semantics.
+
+#ifndef TEST_CM7_STM32H7XX_H_
+#define TEST_CM7_STM32H7XX_H_
+
+#include <stdint.h>
+
+// SSAT: saturate a signed value to sat bits (1..32)
+static inline int32_t __SSAT(int32_t val, uint32_t sat) {
+
+	int64_t max = ((int64_t) 1 << (sat - 1)) - 1;
+	int64_t min = -((int64_t) 1 << (sat - 1));
+
+	if (val > max) {
+		return (int32_t) max;
+	} else if (val < min) {
+		return (int32_t) min;
+	}
+	return val;
+}
+
+// PKHBT: bottom half of a, top half of b shifted left by sh
+static inline uint32_t __PKHBT(int32_t a, int32_t b, uint32_t sh) {
+	return ((uint32_t) a & 0xFFFFu) | (((uint32_t) b << sh) & 0xFFFF0000u);
+}
+
+#endif /* TEST_CM7_STM32H7XX_H_ */
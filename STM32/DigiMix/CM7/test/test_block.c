@@ -0,0 +1,115 @@
+/*
+ * test_block.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// IFX_PeakingFilter_ProcessBlock against IFX_PeakingFilter_Update on the same input, with the band
+// retuned between blocks the way controlTask does it. The two structures round differently, so the
+// check uses the tolerance documented on ProcessBlock: ~1e-5 of the signal peak above 1 kHz, ~1e-3
+// for 30 Hz / Q 3.
+
+#include "IFX_PeakingFilter.h"
+#include "test_util.h"
+
+#include <math.h>
+
+#define FS 48000.0f
+#define BLOCK 32
+#define BLOCKS 600
+#define RETUNE_EVERY 50
+
+typedef struct {
+	float fc;
+	float Q;
+	float gainDb;
+} Band;
+
+static uint32_t seed = 1;
+
+static float noise(void) {
+	seed = seed * 1664525u + 1013904223u;
+	return (float) (int32_t) seed * (1.0f / 2147483648.0f);
+}
+
+// Bands are applied in order, one every RETUNE_EVERY blocks, to both filters between two blocks
+static void runBlocks(const char *name, const Band *bands, uint32_t numBands, float tolerance) {
+
+	IFX_PeakingFilter perSample, block;
+	IFX_PeakingFilter_Init(&perSample, FS);
+	IFX_PeakingFilter_Init(&block, FS);
+
+	float in[BLOCK], out[BLOCK];
+	float peak = 0.0f, worst = 0.0f;
+
+	for (uint32_t b = 0; b < BLOCKS; b++) {
+
+		if (b % RETUNE_EVERY == 0) {
+			const Band *band = &bands[(b / RETUNE_EVERY) % numBands];
+			float gain = powf(10.0f, band->gainDb / 20.0f);
+			IFX_PeakingFilter_SetParameters(&perSample, band->fc, band->Q, gain);
+			IFX_PeakingFilter_SetParameters(&block, band->fc, band->Q, gain);
+		}
+
+		for (uint32_t i = 0; i < BLOCK; i++) {
+			in[i] = 0.5f * noise();
+		}
+
+		IFX_PeakingFilter_ProcessBlock(&block, in, out, BLOCK);
+
+		for (uint32_t i = 0; i < BLOCK; i++) {
+			float ref = IFX_PeakingFilter_Update(&perSample, in[i]);
+			float err = fabsf(out[i] - ref);
+
+			if (fabsf(ref) > peak) {
+				peak = fabsf(ref);
+			}
+			if (err > worst) {
+				worst = err;
+			}
+		}
+	}
+
+	TEST_CHECK(worst <= tolerance * peak, "%s: block vs per-sample %.3g of peak, limit %.3g", name, worst / peak, tolerance);
+	printf("%s: block vs per-sample %.2e of peak\n", name, worst / peak);
+}
+
+int main(void) {
+
+	static const Band high[] = {
+		{ 1000.0f, 1.0f, 6.0f },
+		{ 4000.0f, 3.0f, -12.0f },
+		{ 12000.0f, 0.5f, 20.0f },
+		{ 2500.0f, 0.7f, -20.0f },
+	};
+	static const Band low[] = {
+		{ 30.0f, 3.0f, 12.0f },
+		{ 30.0f, 3.0f, -12.0f },
+		{ 30.0f, 3.0f, 20.0f },
+	};
+
+	runBlocks("above 1 kHz", high, sizeof(high) / sizeof(high[0]), 1e-5f);
+	runBlocks("30 Hz Q 3", low, sizeof(low) / sizeof(low[0]), 1e-3f);
+
+	// A block of one and an empty block are the edge cases of the history hand-over
+	IFX_PeakingFilter a, b;
+	IFX_PeakingFilter_Init(&a, FS);
+	IFX_PeakingFilter_Init(&b, FS);
+	IFX_PeakingFilter_SetParameters(&a, 1000.0f, 1.0f, 2.0f);
+	IFX_PeakingFilter_SetParameters(&b, 1000.0f, 1.0f, 2.0f);
+
+	float worst = 0.0f;
+	for (uint32_t i = 0; i < 256; i++) {
+		float x = 0.5f * noise();
+		float y;
+		IFX_PeakingFilter_ProcessBlock(&b, &x, &y, 1);
+		IFX_PeakingFilter_ProcessBlock(&b, &x, &y, 0);
+		float err = fabsf(y - IFX_PeakingFilter_Update(&a, x));
+		if (err > worst) {
+			worst = err;
+		}
+	}
+	TEST_CHECK(worst <= 1e-5f, "blocks of 1: %.3g", worst);
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,111 @@
+/*
+ * test_coefdesign.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// Maximum relative error of the IFX_CoefDesign helpers against double precision libm, checked
+// against the bounds documented in IFX_CoefDesign.h. IFX_Exp2 is static and is covered through
+// IFX_DbToLinear and IFX_VolumeToLinear. The libm float calls it replaces are measured the same way
+// for comparison.
+
+#include "IFX_CoefDesign.h"
+#include "test_util.h"
+
+#include <math.h>
+
+#define PI_D 3.14159265358979323846
+#define STEPS 200000
+
+static double relError(double value, double ref) {
+	return fabs(value - ref) / fabs(ref);
+}
+
+// x is rounded to float first so both sides see the same argument
+static void checkTanPi(float x0, float x1, double bound) {
+
+	double worst = 0.0, worstLibm = 0.0;
+
+	for (uint32_t i = 0; i <= STEPS; i++) {
+		float x = x0 + (x1 - x0) * (float) i / STEPS;
+
+		if (x <= 0.0f) {
+			continue;
+		}
+
+		double ref = tan(PI_D * (double) x);
+		double err = relError(IFX_TanPi(x), ref);
+		double errLibm = relError(tanf(3.14159265358979f * x), ref);
+
+		TEST_CHECK(err < bound, "IFX_TanPi(%.9g): rel. error %.3g, bound %.3g", x, err, bound);
+
+		if (err > worst) {
+			worst = err;
+		}
+		if (errLibm > worstLibm) {
+			worstLibm = errLibm;
+		}
+	}
+
+	printf("IFX_TanPi [%g, %g]: max rel. error %.2e (tanf %.2e)\n", x0, x1, worst, worstLibm);
+}
+
+static void checkDbToLinear(float dB0, float dB1, double bound) {
+
+	double worst = 0.0, worstLibm = 0.0;
+
+	for (uint32_t i = 0; i <= STEPS; i++) {
+		float dB = dB0 + (dB1 - dB0) * (float) i / STEPS;
+
+		double ref = pow(10.0, (double) dB / 20.0);
+		double err = relError(IFX_DbToLinear(dB), ref);
+		double errLibm = relError(powf(10.0f, dB / 20.0f), ref);
+
+		TEST_CHECK(err < bound, "IFX_DbToLinear(%.9g): rel. error %.3g, bound %.3g", dB, err, bound);
+
+		if (err > worst) {
+			worst = err;
+		}
+		if (errLibm > worstLibm) {
+			worstLibm = errLibm;
+		}
+	}
+
+	printf("IFX_DbToLinear [%g, %g]: max rel. error %.2e (powf %.2e)\n", dB0, dB1, worst, worstLibm);
+}
+
+static void checkVolumeToLinear(void) {
+
+	double worst = 0.0;
+
+	for (uint32_t v = 0; v <= 100; v++) {
+		double ref = pow(10.0, 2.0 * ((double) v / 100.0 - 1.0));
+		double err = relError(IFX_VolumeToLinear((uint8_t) v), ref);
+
+		TEST_CHECK(err < 1e-6, "IFX_VolumeToLinear(%u): rel. error %.3g", (unsigned) v, err);
+
+		if (err > worst) {
+			worst = err;
+		}
+	}
+
+	// Out of range positions clamp to the top of the fader
+	TEST_CHECK(IFX_VolumeToLinear(255) == IFX_VolumeToLinear(100), "IFX_VolumeToLinear(255) does not clamp");
+
+	printf("IFX_VolumeToLinear [0, 100]: max rel. error %.2e\n", worst);
+}
+
+int main(void) {
+
+	checkTanPi(0.0f, 0.45f, 3e-7);
+	checkTanPi(0.45f, 0.49f, 2e-6);
+	checkDbToLinear(-120.0f, 40.0f, 1e-6);
+	checkVolumeToLinear();
+
+	// Edge cases: non-positive arguments and the clamp just below Nyquist
+	TEST_CHECK(IFX_TanPi(0.0f) == 0.0f && IFX_TanPi(-0.1f) == 0.0f, "IFX_TanPi of x <= 0 is not 0");
+	TEST_CHECK(IFX_TanPi(0.6f) == IFX_TanPi(0.4999f), "IFX_TanPi does not clamp above 0.4999");
+	TEST_CHECK(IFX_DbToLinear(-3000.0f) == 0.0f, "IFX_DbToLinear does not flush to 0");
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,164 @@
+/*
+ * test_convert.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// IFX_Int24ToFloatPlanar / IFX_FloatPlanarToInt24 on TDM frames: each slot lands in its own plane
+// and back, both agree with the strided per-channel kernels, out-of-range floats saturate and every
+// 24-bit sample survives the round trip.
+
+#include "IFX_SampleConvert.h"
+#include "test_util.h"
+
+#include <string.h>
+
+#define SLOTS 8
+#define FRAMES 203		// not a multiple of the unroll factor
+
+static int32_t tdm[FRAMES * SLOTS];
+static int32_t tdmOut[FRAMES * SLOTS];
+static int32_t tdmRef[FRAMES * SLOTS];
+static float planes[SLOTS][FRAMES];
+static float planesRef[SLOTS][FRAMES];
+static float *const planePtr[SLOTS] = {
+	planes[0], planes[1], planes[2], planes[3], planes[4], planes[5], planes[6], planes[7],
+};
+
+// Left-aligned 24-bit slot of a sample
+static int32_t slot24(int32_t sample) {
+	return sample * 256;
+}
+
+// Every slot gets a value that encodes its frame and slot, so a misplaced sample shows up
+static void testDeinterleave(void) {
+
+	for (uint32_t i = 0; i < FRAMES; i++) {
+		for (uint32_t ch = 0; ch < SLOTS; ch++) {
+			int32_t sample = (int32_t) (i * SLOTS + ch) * ((ch & 1) ? -1 : 1);
+			tdm[i * SLOTS + ch] = slot24(sample);
+		}
+	}
+
+	// numCh below SLOTS too: a link carrying fewer slots than the buffer has planes
+	for (uint32_t numCh = 1; numCh <= SLOTS; numCh++) {
+		memset(planes, 0, sizeof(planes));
+		IFX_Int24ToFloatPlanar(tdm, numCh, planePtr, FRAMES);
+
+		for (uint32_t ch = 0; ch < SLOTS; ch++) {
+			IFX_Int24ToFloat(&tdm[ch], numCh, planesRef[ch], FRAMES);
+
+			for (uint32_t i = 0; i < FRAMES; i++) {
+				float expected = (ch < numCh) ? (float) tdm[i * numCh + ch] * (1.0f / 2147483648.0f) : 0.0f;
+
+				if (ch < numCh) {
+					TEST_CHECK(planes[ch][i] == planesRef[ch][i], "%u slots, plane %u[%u]: %.9g, strided %.9g", (unsigned) numCh, (unsigned) ch, (unsigned) i, planes[ch][i], planesRef[ch][i]);
+				}
+				TEST_CHECK(planes[ch][i] == expected, "%u slots, plane %u[%u]: %.9g, expected %.9g", (unsigned) numCh, (unsigned) ch, (unsigned) i, planes[ch][i], expected);
+			}
+		}
+	}
+}
+
+static void testInterleave(void) {
+
+	for (uint32_t ch = 0; ch < SLOTS; ch++) {
+		for (uint32_t i = 0; i < FRAMES; i++) {
+			planes[ch][i] = (float) ((int32_t) (i * SLOTS + ch) - 800) * (1.0f / 8388608.0f);
+		}
+	}
+
+	for (uint32_t numCh = 1; numCh <= SLOTS; numCh++) {
+		memset(tdmOut, 0x55, sizeof(tdmOut));
+		memset(tdmRef, 0x55, sizeof(tdmRef));
+
+		IFX_FloatPlanarToInt24((const float *const *) planePtr, numCh, tdmOut, FRAMES);
+		for (uint32_t ch = 0; ch < numCh; ch++) {
+			IFX_FloatToInt24(planes[ch], &tdmRef[ch], numCh, FRAMES);
+		}
+
+		// Same words as the strided kernel, nothing written past the numCh * FRAMES words
+		TEST_CHECK(memcmp(tdmOut, tdmRef, sizeof(tdmOut)) == 0, "%u slots: planar and strided outputs differ", (unsigned) numCh);
+
+		for (uint32_t i = 0; i < FRAMES; i++) {
+			for (uint32_t ch = 0; ch < numCh; ch++) {
+				int32_t expected = slot24((int32_t) (i * SLOTS + ch) - 800);
+				TEST_CHECK(tdmOut[i * numCh + ch] == expected, "%u slots, frame %u slot %u: %ld, expected %ld", (unsigned) numCh, (unsigned) i, (unsigned) ch, (long) tdmOut[i * numCh + ch], (long) expected);
+			}
+		}
+	}
+}
+
+static void testSaturation(void) {
+
+	static const struct {
+		float in;
+		int32_t sample;
+	} cases[] = {
+		{ 1.0f, 8388607 },
+		{ 1.5f, 8388607 },
+		{ 100.0f, 8388607 },
+		{ -1.0f, -8388608 },
+		{ -1.5f, -8388608 },
+		{ -100.0f, -8388608 },
+		{ 8388607.0f / 8388608.0f, 8388607 },
+		{ -8388607.0f / 8388608.0f, -8388607 },
+		{ 0.5f, 4194304 },
+		{ -0.5f, -4194304 },
+	};
+	const uint32_t numCases = sizeof(cases) / sizeof(cases[0]);
+
+	// Every case in every slot position of a 4 frame unrolled step and of the tail
+	for (uint32_t c = 0; c < numCases; c++) {
+		for (uint32_t ch = 0; ch < SLOTS; ch++) {
+			for (uint32_t i = 0; i < FRAMES; i++) {
+				planes[ch][i] = cases[c].in;
+			}
+		}
+
+		IFX_FloatPlanarToInt24((const float *const *) planePtr, SLOTS, tdmOut, FRAMES);
+
+		uint32_t wrong = 0;
+		for (uint32_t w = 0; w < FRAMES * SLOTS; w++) {
+			wrong += (tdmOut[w] != slot24(cases[c].sample));
+		}
+		TEST_CHECK(wrong == 0, "%.9g: %u of %u slots not %ld", cases[c].in, (unsigned) wrong, (unsigned) (FRAMES * SLOTS), (long) cases[c].sample);
+	}
+}
+
+// Every 24-bit sample through TDM -> planar -> TDM, one block of FRAMES * SLOTS samples at a time
+static void testRoundTrip(void) {
+
+	uint32_t wrong = 0;
+	int32_t sample = -8388608;
+
+	while (sample <= 8388607) {
+		for (uint32_t w = 0; w < FRAMES * SLOTS; w++) {
+			tdm[w] = slot24((sample <= 8388607) ? sample : 0);
+			sample++;
+		}
+
+		IFX_Int24ToFloatPlanar(tdm, SLOTS, planePtr, FRAMES);
+		IFX_FloatPlanarToInt24((const float *const *) planePtr, SLOTS, tdmOut, FRAMES);
+
+		for (uint32_t w = 0; w < FRAMES * SLOTS; w++) {
+			if (tdmOut[w] != tdm[w]) {
+				if (wrong++ < 10) {
+					printf("round trip: %ld came back as %ld\n", (long) (tdm[w] / 256), (long) (tdmOut[w] / 256));
+				}
+			}
+		}
+	}
+
+	TEST_CHECK(wrong == 0, "round trip: %u of 2^24 samples changed", (unsigned) wrong);
+}
+
+int main(void) {
+
+	testDeinterleave();
+	testInterleave();
+	testSaturation();
+	testRoundTrip();
+
+	return TEST_RESULT();
+}
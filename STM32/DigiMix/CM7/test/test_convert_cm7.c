@@ -0,0 +1,156 @@
+/*
+ * test_convert_cm7.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// The CORE_CM7 build of IFX_SampleConvert (VCVT + SSAT) must give exactly the same integers as
+// the portable clamp-then-convert path. This file compiles IFX_SampleConvert.c a second time with
+// CORE_CM7 and renamed entry points, against cm7/stm32h7xx.h, and compares both on the same input.
+//
+// Inputs stay within +/-8 of full scale: on the M7 VCVT also saturates huge values to int32 before
+// SSAT, but on the host converting a float beyond the int32 range is undefined, so that part of the
+// hardware path cannot be reproduced here.
+
+#define CORE_CM7
+
+// Memory placement does not matter on the host
+#define INC_IFX_FASTMEM_H_
+#define DSP_FAST_CODE
+#define DSP_FAST_BSS
+
+#define IFX_Int16ToFloat CM7_Int16ToFloat
+#define IFX_FloatToInt16 CM7_FloatToInt16
+#define IFX_Int16StereoToFloat CM7_Int16StereoToFloat
+#define IFX_FloatToInt16Stereo CM7_FloatToInt16Stereo
+#define IFX_Int24ToFloat CM7_Int24ToFloat
+#define IFX_FloatToInt24 CM7_FloatToInt24
+#define IFX_Int24ToFloatPlanar CM7_Int24ToFloatPlanar
+#define IFX_FloatPlanarToInt24 CM7_FloatPlanarToInt24
+
+#include "../Core/Src/IFX_SampleConvert.c"
+
+#undef CORE_CM7
+#undef IFX_Int16ToFloat
+#undef IFX_FloatToInt16
+#undef IFX_Int16StereoToFloat
+#undef IFX_FloatToInt16Stereo
+#undef IFX_Int24ToFloat
+#undef IFX_FloatToInt24
+#undef IFX_Int24ToFloatPlanar
+#undef IFX_FloatPlanarToInt24
+
+// Portable versions, from the ifx library
+#undef INC_IFX_SAMPLECONVERT_H_
+#include "IFX_SampleConvert.h"
+
+#include "test_util.h"
+
+#include <string.h>
+
+#define N 4099		// not a multiple of the unroll factor
+#define SLOTS 8
+
+static float in[N];
+
+// Full scale and its neighbours, the 16 and 24-bit rails and their neighbours, then noise
+static void fillInput(void) {
+
+	static const float edges[] = {
+		0.0f, -0.0f, 1.0f, -1.0f, 0.5f, -0.5f,
+		32767.0f / 32767.0f, 32766.5f / 32767.0f, 32767.5f / 32767.0f, -32768.0f / 32767.0f, -32768.5f / 32767.0f,
+		8388607.0f / 8388608.0f, 8388606.5f / 8388608.0f, 8388607.5f / 8388608.0f, -8388609.0f / 8388608.0f,
+		1.0000001f, -1.0000001f, 0.99999994f, -0.99999994f, 8.0f, -8.0f, 1e-9f, -1e-9f,
+	};
+	const uint32_t numEdges = sizeof(edges) / sizeof(edges[0]);
+
+	uint32_t seed = 7;
+
+	for (uint32_t i = 0; i < N; i++) {
+		if (i < numEdges) {
+			in[i] = edges[i];
+		} else {
+			seed = seed * 1664525u + 1013904223u;
+			in[i] = (float) (int32_t) seed * (2.0f / 2147483648.0f);	// +/-2 full scale
+		}
+	}
+}
+
+int main(void) {
+
+	static int16_t out16[2 * N], ref16[2 * N];
+	static int32_t outPk[N], refPk[N];
+	static int16_t mono16[N];
+	static float rev[N];
+	static float back[2][N], backRef[2][N];
+	static int32_t out24[2 * N], ref24[2 * N];
+	static int32_t outTdm[N * SLOTS], refTdm[N * SLOTS];
+	static float planes[SLOTS][N];
+
+	fillInput();
+
+	// 16-bit, strided into a stereo buffer
+	memset(out16, 0, sizeof(out16));
+	memset(ref16, 0, sizeof(ref16));
+	CM7_FloatToInt16(in, out16 + 1, 2, N);
+	IFX_FloatToInt16(in, ref16 + 1, 2, N);
+	for (uint32_t i = 0; i < 2 * N; i++) {
+		TEST_CHECK(out16[i] == ref16[i], "FloatToInt16[%u] (in %.9g): cm7 %d, portable %d", (unsigned) i, in[i / 2], out16[i], ref16[i]);
+	}
+
+	// Packed pairs, left = in, right = in reversed
+	for (uint32_t i = 0; i < N; i++) {
+		rev[i] = in[N - 1 - i];
+	}
+	CM7_FloatToInt16Stereo(in, rev, 1, outPk, N);
+	IFX_FloatToInt16Stereo(in, rev, 1, refPk, N);
+	for (uint32_t i = 0; i < N; i++) {
+		TEST_CHECK(outPk[i] == refPk[i], "FloatToInt16Stereo[%u] (in %.9g, %.9g): cm7 %08lx, portable %08lx", (unsigned) i, in[i], rev[i], (unsigned long) outPk[i], (unsigned long) refPk[i]);
+		TEST_CHECK(refPk[i] == (int32_t) (((uint32_t) (uint16_t) ref16[2 * i + 1]) | ((uint32_t) (uint16_t) ref16[2 * (N - 1 - i) + 1] << 16)),
+				"FloatToInt16Stereo[%u]: differs from two FloatToInt16 passes", (unsigned) i);
+	}
+
+	// Packed mono stream, as the UART tap writes it: same bytes as the plain stride-1 conversion
+	memset(outPk, 0, sizeof(outPk));
+	CM7_FloatToInt16Stereo(in, in + 1, 2, outPk, (N - 1) / 2);
+	IFX_FloatToInt16(in, mono16, 1, N - 1);
+	TEST_CHECK(memcmp(outPk, mono16, (N - 1) * sizeof(int16_t)) == 0, "FloatToInt16Stereo stride 2: packed mono differs from FloatToInt16");
+
+	// Unpack: bit exact with the portable build and with Int16ToFloat, for pairs and the mono stream
+	CM7_Int16StereoToFloat(refPk, back[0], back[1], 1, N);
+	IFX_Int16StereoToFloat(refPk, backRef[0], backRef[1], 1, N);
+	TEST_CHECK(memcmp(back, backRef, sizeof(back)) == 0, "Int16StereoToFloat: cm7 and portable differ");
+	IFX_Int16ToFloat(ref16 + 1, 2, backRef[0], N);
+	TEST_CHECK(memcmp(back[0], backRef[0], sizeof(back[0])) == 0, "Int16StereoToFloat: left differs from Int16ToFloat");
+
+	CM7_Int16StereoToFloat(outPk, back[0], back[0] + 1, 2, (N - 1) / 2);
+	IFX_Int16ToFloat(mono16, 1, backRef[0], N - 1);
+	TEST_CHECK(memcmp(back[0], backRef[0], (N - 1) * sizeof(float)) == 0, "Int16StereoToFloat stride 2: mono stream differs from Int16ToFloat");
+
+	// 24-bit slots, strided
+	memset(out24, 0, sizeof(out24));
+	memset(ref24, 0, sizeof(ref24));
+	CM7_FloatToInt24(in, out24, 2, N);
+	IFX_FloatToInt24(in, ref24, 2, N);
+	for (uint32_t i = 0; i < 2 * N; i++) {
+		TEST_CHECK(out24[i] == ref24[i], "FloatToInt24[%u] (in %.9g): cm7 %ld, portable %ld", (unsigned) i, in[i / 2], (long) out24[i], (long) ref24[i]);
+	}
+
+	// 24-bit TDM from planar, every slot a shifted copy of the input
+	const float *planePtr[SLOTS];
+	for (uint32_t ch = 0; ch < SLOTS; ch++) {
+		for (uint32_t i = 0; i < N; i++) {
+			planes[ch][i] = in[(i + 97 * ch) % N];
+		}
+		planePtr[ch] = planes[ch];
+	}
+	CM7_FloatPlanarToInt24(planePtr, SLOTS, outTdm, N);
+	IFX_FloatPlanarToInt24(planePtr, SLOTS, refTdm, N);
+	TEST_CHECK(memcmp(outTdm, refTdm, sizeof(outTdm)) == 0, "FloatPlanarToInt24: cm7 and portable differ");
+
+	// Spot check the rails so the comparison cannot pass with both paths equally wrong
+	TEST_CHECK(ref16[2 * 10 + 1] == -32768 && ref16[2 * 2 + 1] == 32767, "16-bit rails");
+	TEST_CHECK(ref24[2 * 14] == -8388608 * 256 && ref24[2 * 2] == 8388607 * 256, "24-bit rails");
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,418 @@
+/*
+ * test_ctrl_link.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// CTRL_Link framing shared with the ESP32: COBS round trips, MsgLen on every message type and its
+// truncations, random batches decoded back to the same updates, every single-byte corruption of
+// a frame rejected without an update handed out, and random input (raw, and CRC-valid with random
+// messages) decoded without touching memory outside the frame.
+
+#include "CTRL_Link.h"
+#include "test_util.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_MSGS 128
+
+static uint32_t rngState = 0x12345678u;
+
+// xorshift32: same sequence on every run
+static uint32_t rng(void) {
+	rngState ^= rngState << 13;
+	rngState ^= rngState >> 17;
+	rngState ^= rngState << 5;
+	return rngState;
+}
+
+typedef struct {
+	CTRL_LinkMsg msgs[MAX_MSGS];
+	uint32_t count;
+} MsgList;
+
+static void collect(const CTRL_LinkMsg *msg, void *ctx) {
+
+	MsgList *list = (MsgList *) ctx;
+
+	if (list->count < MAX_MSGS) {
+		list->msgs[list->count] = *msg;
+	}
+	list->count++;
+}
+
+static int msgEqual(const CTRL_LinkMsg *a, const CTRL_LinkMsg *b) {
+	return a->type == b->type && a->ch == b->ch && a->value == b->value && a->band == b->band
+			&& a->freq_Hz == b->freq_Hz && a->gain_cdB == b->gain_cdB && a->q_milli == b->q_milli
+			&& a->baud == b->baud && a->rxBytes == b->rxBytes && a->rxFrames == b->rxFrames
+			&& a->rxErrors == b->rxErrors;
+}
+
+static CTRL_LinkMsg *expect(MsgList *list, uint8_t type, uint8_t ch) {
+
+	CTRL_LinkMsg *m = &list->msgs[list->count++];
+
+	memset(m, 0, sizeof(*m));
+	m->type = type;
+	m->ch = ch;
+
+	return m;
+}
+
+// Random bytes; mode 1 has no zeros, mode 2 is mostly zeros, mode 3 all zeros
+static void fillRandom(uint8_t *buf, size_t n, uint32_t mode) {
+
+	for (size_t i = 0; i < n; i++) {
+		uint8_t v = (uint8_t) rng();
+
+		if (mode == 1) {
+			v |= (v == 0);
+		} else if (mode == 2) {
+			v = (rng() % 8 == 0) ? v : 0;
+		} else if (mode == 3) {
+			v = 0;
+		}
+		buf[i] = v;
+	}
+}
+
+static void checkCobs(const uint8_t *in, size_t n) {
+
+	static uint8_t enc[1024];
+	static uint8_t dec[1024];
+
+	size_t encLen = CTRL_Link_CobsEncode(in, n, enc);
+
+	TEST_CHECK(encLen <= n + n / 254 + 1, "COBS %u bytes: encoded to %u", (unsigned) n, (unsigned) encLen);
+	TEST_CHECK(memchr(enc, 0, encLen) == NULL, "COBS %u bytes: 0x00 in the encoded frame", (unsigned) n);
+
+	// An empty input encodes to one byte, which decodes to the 0 that also means invalid
+	size_t decLen = CTRL_Link_CobsDecode(enc, encLen, dec, n);
+	TEST_CHECK(decLen == n && memcmp(dec, in, n) == 0, "COBS %u bytes: decoded %u bytes, %s", (unsigned) n, (unsigned) decLen,
+			(decLen == n) ? "content differs" : "length differs");
+
+	if (n > 0) {
+		TEST_CHECK(CTRL_Link_CobsDecode(enc, encLen, dec, n - 1) == 0, "COBS %u bytes: decoded into %u", (unsigned) n, (unsigned) (n - 1));
+	}
+}
+
+static void testCobs(void) {
+
+	static uint8_t buf[600];
+
+	// Group boundaries: runs of non-zero bytes up to and past the 254 byte group, with and without a
+	// zero after them
+	static const size_t runs[] = { 0, 1, 253, 254, 255, 256, 507, 508, 509 };
+	for (uint32_t r = 0; r < sizeof(runs) / sizeof(runs[0]); r++) {
+		fillRandom(buf, runs[r], 1);
+		checkCobs(buf, runs[r]);
+
+		buf[runs[r]] = 0;
+		checkCobs(buf, runs[r] + 1);
+	}
+
+	for (uint32_t iter = 0; iter < 4000; iter++) {
+		size_t n = rng() % sizeof(buf);
+
+		fillRandom(buf, n, iter % 4);
+		checkCobs(buf, n);
+	}
+
+	static const struct {
+		uint8_t bytes[4];
+		size_t n;
+	} invalid[] = {
+		{ { 0x00 }, 1 },					// delimiter as a code
+		{ { 0x03, 0x11 }, 2 },				// group runs past the end
+		{ { 0x03, 0x00, 0x11 }, 3 },		// delimiter inside a group
+		{ { 0x02, 0x11, 0x00 }, 3 },
+		{ { 0xFF, 0x11 }, 2 },
+	};
+	for (uint32_t c = 0; c < sizeof(invalid) / sizeof(invalid[0]); c++) {
+		uint8_t dec[8];
+		TEST_CHECK(CTRL_Link_CobsDecode(invalid[c].bytes, invalid[c].n, dec, sizeof(dec)) == 0, "invalid COBS case %u accepted", (unsigned) c);
+	}
+}
+
+static void testMsgLen(void) {
+
+	static const struct {
+		uint8_t type;
+		uint8_t count;		// VOLUME_BULK count byte
+		size_t len;
+	} cases[] = {
+		{ CTRL_MSG_VOLUME, 0, 3 },
+		{ CTRL_MSG_EQ_BAND, 0, 9 },
+		{ CTRL_MSG_MUTE, 0, 3 },
+		{ CTRL_MSG_VOLUME_BULK, 0, 3 },
+		{ CTRL_MSG_VOLUME_BULK, 1, 4 },
+		{ CTRL_MSG_VOLUME_BULK, 10, 13 },
+		{ CTRL_MSG_VOLUME_BULK, 255, 258 },
+		{ CTRL_MSG_LINK_SETUP, 0, 6 },
+		{ CTRL_MSG_LINK_ACK, 0, 6 },
+		{ CTRL_MSG_LINK_PING, 0, 2 },
+		{ CTRL_MSG_LINK_STATS, 0, 14 },
+	};
+
+	static uint8_t msg[300];
+
+	for (uint32_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+		memset(msg, 0xA5, sizeof(msg));
+		msg[0] = cases[c].type;
+		msg[2] = cases[c].count;
+
+		size_t len = cases[c].len;
+		TEST_CHECK(CTRL_Link_MsgLen(msg, len) == len, "type 0x%02x: length %u", cases[c].type, (unsigned) CTRL_Link_MsgLen(msg, len));
+		TEST_CHECK(CTRL_Link_MsgLen(msg, sizeof(msg)) == len, "type 0x%02x: length %u with more bytes after it", cases[c].type,
+				(unsigned) CTRL_Link_MsgLen(msg, sizeof(msg)));
+
+		// Every truncation, down to the type byte alone, in a buffer of exactly that size so the
+		// sanitizer build catches a read past it
+		for (size_t n = 1; n < len; n++) {
+			uint8_t *cut = malloc(n);
+			memcpy(cut, msg, n);
+			TEST_CHECK(CTRL_Link_MsgLen(cut, n) == 0, "type 0x%02x truncated to %u bytes: length %u", cases[c].type, (unsigned) n,
+					(unsigned) CTRL_Link_MsgLen(cut, n));
+			free(cut);
+		}
+	}
+
+	// Every type byte that is not a message
+	for (uint32_t type = 0; type < 256; type++) {
+		int known = 0;
+		for (uint32_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+			known |= (cases[c].type == type);
+		}
+		if (!known) {
+			msg[0] = (uint8_t) type;
+			TEST_CHECK(CTRL_Link_MsgLen(msg, sizeof(msg)) == 0, "unknown type 0x%02x: length %u", (unsigned) type,
+					(unsigned) CTRL_Link_MsgLen(msg, sizeof(msg)));
+		}
+	}
+}
+
+// A batch of random messages until it is full or a random stop, and the updates Decode must hand out
+static void randomBatch(CTRL_LinkBatch *b, MsgList *expected) {
+
+	CTRL_Link_BatchInit(b);
+	expected->count = 0;
+
+	do {
+		uint32_t kind = rng() % 8;
+		uint8_t ch = (uint8_t) rng();
+		uint8_t v = (uint8_t) rng();
+		CTRL_LinkMsg *m;
+		int added;
+
+		// Room for the largest message's updates, so a refused add never overflows the list
+		if (expected->count + 20 > MAX_MSGS) {
+			break;
+		}
+
+		if (kind == 0) {
+			added = CTRL_Link_AddVolume(b, ch, v);
+			if (added) {
+				expect(expected, CTRL_MSG_VOLUME, ch)->value = v;
+			}
+		} else if (kind == 1) {
+			uint8_t band = (uint8_t) rng();
+			uint16_t freq = (uint16_t) rng();
+			int16_t gain = (int16_t) (uint16_t) rng();
+			uint16_t q = (uint16_t) rng();
+
+			added = CTRL_Link_AddEqBand(b, ch, band, freq, gain, q);
+			if (added) {
+				m = expect(expected, CTRL_MSG_EQ_BAND, ch);
+				m->band = band;
+				m->freq_Hz = freq;
+				m->gain_cdB = gain;
+				m->q_milli = q;
+			}
+		} else if (kind == 2) {
+			added = CTRL_Link_AddMute(b, ch, v);
+			if (added) {
+				expect(expected, CTRL_MSG_MUTE, ch)->value = (v != 0);
+			}
+		} else if (kind == 3) {
+			uint8_t volumes[20];
+			uint8_t count = (uint8_t) (rng() % 21);
+
+			fillRandom(volumes, count, 0);
+			added = CTRL_Link_AddVolumeBulk(b, ch, count, volumes);
+			for (uint8_t k = 0; added && k < count; k++) {
+				expect(expected, CTRL_MSG_VOLUME, (uint8_t) (ch + k))->value = volumes[k];
+			}
+		} else if (kind == 4 || kind == 5) {
+			uint8_t type = (kind == 4) ? CTRL_MSG_LINK_SETUP : CTRL_MSG_LINK_ACK;
+			uint32_t baud = rng();
+
+			added = CTRL_Link_AddLinkSetup(b, type, baud, v);
+			if (added) {
+				m = expect(expected, type, 0);
+				m->baud = baud;
+				m->value = v;
+			}
+		} else if (kind == 6) {
+			added = CTRL_Link_AddLinkPing(b, v);
+			if (added) {
+				expect(expected, CTRL_MSG_LINK_PING, 0)->value = v;
+			}
+		} else {
+			uint32_t rxBytes = rng(), rxFrames = rng(), rxErrors = rng();
+
+			added = CTRL_Link_AddLinkStats(b, v, rxBytes, rxFrames, rxErrors);
+			if (added) {
+				m = expect(expected, CTRL_MSG_LINK_STATS, 0);
+				m->value = v;
+				m->rxBytes = rxBytes;
+				m->rxFrames = rxFrames;
+				m->rxErrors = rxErrors;
+			}
+		}
+
+		if (!added) {
+			break;
+		}
+	} while (rng() % 16 != 0);
+}
+
+static void testRandomFrames(void) {
+
+	static CTRL_LinkBatch batch;
+	static MsgList expected, got;
+	static uint8_t wire[CTRL_LINK_MAX_WIRE];
+
+	for (uint32_t iter = 0; iter < 20000; iter++) {
+		randomBatch(&batch, &expected);
+
+		size_t n = CTRL_Link_BatchFinish(&batch, wire);
+		TEST_CHECK(CTRL_Link_BatchEmpty(&batch), "frame %u: batch not reset by BatchFinish", (unsigned) iter);
+		TEST_CHECK(n >= 4 && n <= CTRL_LINK_MAX_WIRE, "frame %u: %u bytes on the wire", (unsigned) iter, (unsigned) n);
+		TEST_CHECK(wire[0] == 0 && wire[n - 1] == 0 && memchr(&wire[1], 0, n - 2) == NULL, "frame %u: delimiters wrong", (unsigned) iter);
+
+		got.count = 0;
+		CTRL_LinkStatus status = CTRL_Link_Decode(&wire[1], n - 2, collect, &got);
+
+		TEST_CHECK(status == CTRL_LINK_OK, "frame %u: status %d", (unsigned) iter, (int) status);
+		TEST_CHECK(got.count == expected.count, "frame %u: %u updates, sent %u", (unsigned) iter, (unsigned) got.count,
+				(unsigned) expected.count);
+		for (uint32_t k = 0; k < got.count && k < expected.count; k++) {
+			TEST_CHECK(msgEqual(&got.msgs[k], &expected.msgs[k]), "frame %u: update %u (type 0x%02x) differs", (unsigned) iter, (unsigned) k,
+					expected.msgs[k].type);
+		}
+	}
+}
+
+// Every single-byte change of the encoded frame (the 8 bit flips and 8 random values at every
+// position) and every truncation: the frame is rejected and no update is handed out
+static void testCorruption(void) {
+
+	static CTRL_LinkBatch batch;
+	static MsgList expected, got;
+	static uint8_t wire[CTRL_LINK_MAX_WIRE];
+	static uint8_t bad[CTRL_LINK_MAX_WIRE];
+
+	uint32_t tried = 0;
+
+	for (uint32_t iter = 0; iter < 300; iter++) {
+		randomBatch(&batch, &expected);
+
+		size_t n = CTRL_Link_BatchFinish(&batch, wire) - 2;
+		const uint8_t *enc = &wire[1];
+
+		for (size_t pos = 0; pos < n; pos++) {
+			for (uint32_t k = 0; k < 16; k++) {
+				uint8_t flip = (k < 8) ? (uint8_t) (1u << k) : (uint8_t) rng();
+
+				if (flip == 0) {
+					continue;
+				}
+
+				memcpy(bad, enc, n);
+				bad[pos] ^= flip;
+
+				got.count = 0;
+				CTRL_LinkStatus status = CTRL_Link_Decode(bad, n, collect, &got);
+				TEST_CHECK(status != CTRL_LINK_OK && got.count == 0, "frame %u: byte %u ^ 0x%02x accepted (status %d, %u updates)",
+						(unsigned) iter, (unsigned) pos, flip, (int) status, (unsigned) got.count);
+				tried++;
+			}
+		}
+
+		for (size_t len = 0; len < n; len++) {
+			got.count = 0;
+			CTRL_LinkStatus status = CTRL_Link_Decode(enc, len, collect, &got);
+			TEST_CHECK(status != CTRL_LINK_OK && got.count == 0, "frame %u: truncated to %u of %u bytes accepted", (unsigned) iter,
+					(unsigned) len, (unsigned) n);
+		}
+	}
+
+	printf("corruption: %u corrupted frames rejected\n", (unsigned) tried);
+}
+
+// Random encoded bytes, and random payloads behind a valid COBS encoding and CRC, so MsgLen and the
+// message checks see every kind of truncated, oversized and unknown message. Decode either accepts
+// the frame or hands out nothing.
+static void testGarbage(void) {
+
+	static uint8_t payload[CTRL_LINK_MAX_PAYLOAD + 8];
+	static uint8_t enc[CTRL_LINK_MAX_ENCODED + 16];
+	static MsgList got;
+
+	uint32_t accepted = 0;
+
+	for (uint32_t iter = 0; iter < 200000; iter++) {
+		CTRL_LinkStatus status;
+		size_t n;
+
+		got.count = 0;
+
+		if (iter & 1) {
+			n = rng() % sizeof(enc);
+			fillRandom(enc, n, 1);
+			status = CTRL_Link_Decode(enc, n, collect, &got);
+		} else {
+			// Random messages behind the version byte: a known type byte often enough to get past it
+			size_t len = 1 + rng() % (sizeof(payload) - 2);
+			fillRandom(payload, len, 0);
+			payload[0] = (rng() % 8 == 0) ? (uint8_t) rng() : CTRL_LINK_VERSION;
+			for (size_t i = 1; i < len; i++) {
+				if (rng() % 4 == 0) {
+					payload[i] = (uint8_t) (CTRL_MSG_VOLUME + rng() % 4);
+				}
+			}
+
+			uint16_t crc = CTRL_Link_Crc16(payload, len);
+			payload[len] = (uint8_t) crc;
+			payload[len + 1] = (uint8_t) (crc >> 8);
+			n = CTRL_Link_CobsEncode(payload, len + 2, enc);
+			status = CTRL_Link_Decode(enc, n, collect, &got);
+
+			if (len + 2 > CTRL_LINK_MAX_PAYLOAD) {
+				TEST_CHECK(status == CTRL_LINK_ERR_COBS, "%u byte payload: status %d", (unsigned) (len + 2), (int) status);
+			} else if (payload[0] != CTRL_LINK_VERSION) {
+				TEST_CHECK(status == CTRL_LINK_ERR_VERSION, "version %u: status %d", payload[0], (int) status);
+			} else {
+				TEST_CHECK(status == CTRL_LINK_OK || status == CTRL_LINK_ERR_MSG, "random messages: status %d", (int) status);
+			}
+		}
+
+		TEST_CHECK(status == CTRL_LINK_OK || got.count == 0, "rejected frame (status %d) handed out %u updates", (int) status,
+				(unsigned) got.count);
+		accepted += (status == CTRL_LINK_OK);
+	}
+
+	printf("garbage: %u of 200000 frames accepted\n", (unsigned) accepted);
+}
+
+int main(void) {
+
+	testCobs();
+	testMsgLen();
+	testRandomFrames();
+	testCorruption();
+	testGarbage();
+
+	return TEST_RESULT();
+}
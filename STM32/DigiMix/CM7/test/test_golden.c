@@ -0,0 +1,145 @@
+/*
+ * test_golden.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// Impulse response regression for IFX_PeakingFilter and IFX_Overdrive against the vectors stored
+// in test_golden.h. After an intended change to either module, regenerate them with
+//
+//   build/test_golden --generate > test_golden.h
+//
+// and review the diff.
+
+#include "IFX_PeakingFilter.h"
+#include "IFX_Overdrive.h"
+#include "test_util.h"
+
+#include <math.h>
+#include <string.h>
+
+#define FS 48000.0f
+#define GOLDEN_PEAKING_LENGTH 64
+#define GOLDEN_OVERDRIVE_LENGTH 128
+
+#include "test_golden.h"
+
+typedef struct {
+	const char *name;
+	float fc;
+	float Q;
+	float gainDb;
+} PeakingCase;
+
+static const PeakingCase peakingCases[] = {
+	{ "peak_1k_q1_p6", 1000.0f, 1.0f, 6.0f },
+	{ "peak_60_q3_m12", 60.0f, 3.0f, -12.0f },
+	{ "peak_10k_q07_p20", 10000.0f, 0.7f, 20.0f },
+};
+
+typedef struct {
+	const char *name;
+	float amplitude;
+	uint8_t oversampling;
+} OverdriveCase;
+
+// Same settings as the channel inserts in main.c; the larger impulse drives the clipper into its knee
+static const OverdriveCase overdriveCases[] = {
+	{ "od_x1_a010", 0.1f, 1 },
+	{ "od_x1_a050", 0.5f, 1 },
+	{ "od_x4_a050", 0.5f, 4 },
+};
+
+#define NUM_PEAKING_CASES (sizeof(peakingCases) / sizeof(peakingCases[0]))
+#define NUM_OVERDRIVE_CASES (sizeof(overdriveCases) / sizeof(overdriveCases[0]))
+
+static void impulsePeaking(const PeakingCase *c, float *out) {
+
+	IFX_PeakingFilter filt;
+	IFX_PeakingFilter_Init(&filt, FS);
+	IFX_PeakingFilter_SetParameters(&filt, c->fc, c->Q, powf(10.0f, c->gainDb / 20.0f));
+
+	for (uint32_t i = 0; i < GOLDEN_PEAKING_LENGTH; i++) {
+		out[i] = IFX_PeakingFilter_Update(&filt, (i == 0) ? 1.0f : 0.0f);
+	}
+}
+
+static void impulseOverdrive(const OverdriveCase *c, float *out) {
+
+	IFX_Overdrive od;
+	IFX_Overdrive_Init(&od, FS, 80.0f, 4.0f, 6000.0f, 0.707f);
+	IFX_Overdrive_SetOversampling(&od, c->oversampling);
+
+	for (uint32_t i = 0; i < GOLDEN_OVERDRIVE_LENGTH; i++) {
+		out[i] = IFX_Overdrive_Update(&od, (i == 0) ? c->amplitude : 0.0f);
+	}
+}
+
+static void printVector(const char *name, const float *v, uint32_t n) {
+
+	printf("static const float %s[%u] = {\n", name, (unsigned) n);
+	for (uint32_t i = 0; i < n; i++) {
+		printf("%s%#.9gf,%s", (i % 6 == 0) ? "\t" : "", v[i], (i % 6 == 5 || i == n - 1) ? "\n" : " ");
+	}
+	printf("};\n\n");
+}
+
+static void generate(void) {
+
+	float out[GOLDEN_OVERDRIVE_LENGTH];
+
+	printf("/*\n * test_golden.h\n *\n *  Generated by test_golden --generate, do not edit by hand\n */\n\n");
+	printf("#ifndef TEST_GOLDEN_H_\n#define TEST_GOLDEN_H_\n\n");
+
+	for (uint32_t c = 0; c < NUM_PEAKING_CASES; c++) {
+		impulsePeaking(&peakingCases[c], out);
+		printVector(peakingCases[c].name, out, GOLDEN_PEAKING_LENGTH);
+	}
+	for (uint32_t c = 0; c < NUM_OVERDRIVE_CASES; c++) {
+		impulseOverdrive(&overdriveCases[c], out);
+		printVector(overdriveCases[c].name, out, GOLDEN_OVERDRIVE_LENGTH);
+	}
+
+	printf("#endif /* TEST_GOLDEN_H_ */\n");
+}
+
+// ~16 float ULP of slack so a different compiler or FMA contraction does not fail the test,
+// while any change to the coefficients or the structure still does
+static void compare(const char *name, const float *out, const float *golden, uint32_t n) {
+
+	float worst = 0.0f;
+
+	for (uint32_t i = 0; i < n; i++) {
+		float err = fabsf(out[i] - golden[i]);
+		TEST_CHECK(err <= 1e-7f + 2e-6f * fabsf(golden[i]), "%s[%u]: %.9g, golden %.9g", name, (unsigned) i, out[i], golden[i]);
+		if (err > worst) {
+			worst = err;
+		}
+	}
+
+	printf("%s: worst error %.2e\n", name, worst);
+}
+
+int main(int argc, char **argv) {
+
+	if (argc > 1 && strcmp(argv[1], "--generate") == 0) {
+		generate();
+		return 0;
+	}
+
+	static const float *const peakingGolden[NUM_PEAKING_CASES] = { peak_1k_q1_p6, peak_60_q3_m12, peak_10k_q07_p20 };
+	static const float *const overdriveGolden[NUM_OVERDRIVE_CASES] = { od_x1_a010, od_x1_a050, od_x4_a050 };
+
+	float out[GOLDEN_OVERDRIVE_LENGTH];
+
+	for (uint32_t c = 0; c < NUM_PEAKING_CASES; c++) {
+		impulsePeaking(&peakingCases[c], out);
+		compare(peakingCases[c].name, out, peakingGolden[c], GOLDEN_PEAKING_LENGTH);
+	}
+	for (uint32_t c = 0; c < NUM_OVERDRIVE_CASES; c++) {
+		impulseOverdrive(&overdriveCases[c], out);
+		compare(overdriveCases[c].name, out, overdriveGolden[c], GOLDEN_OVERDRIVE_LENGTH);
+	}
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,127 @@
+/*
+ * test_golden.h
+ *
+ *  Generated by test_golden --generate, do not edit by hand
+ */
+
+#ifndef TEST_GOLDEN_H_
+#define TEST_GOLDEN_H_
+
+static const float peak_1k_q1_p6[64] = {
+	1.06097448f, 0.113498487f, 0.0967892408f, 0.0805727467f, 0.0650490820f, 0.0503827073f,
+	0.0367041454f, 0.0241120644f, 0.0126755983f, 0.00243684137f, -0.00658650650f, -0.0143984351f,
+	-0.0210219044f, -0.0264961496f, -0.0308740567f, -0.0342196450f, -0.0366056599f, -0.0381113552f,
+	-0.0388204157f, -0.0388190635f, -0.0381943621f, -0.0370327309f, -0.0354186110f, -0.0334333740f,
+	-0.0311543811f, -0.0286542308f, -0.0260001794f, -0.0232537128f, -0.0204702672f, -0.0176990833f,
+	-0.0149831679f, -0.0123593742f, -0.00985855609f, -0.00750581361f, -0.00532079255f, -0.00331803830f,
+	-0.00150738645f, 0.000105618696f, 0.00151928666f, 0.00273533561f, 0.00375844724f, 0.00459582917f,
+	0.00525678881f, 0.00575232739f, 0.00609475374f, 0.00629732851f, 0.00637393398f, 0.00633877423f,
+	0.00620610919f, 0.00599001721f, 0.00570419105f, 0.00536176609f, 0.00497517735f, 0.00455604633f,
+	0.00411509164f, 0.00366207003f, 0.00320573663f, 0.00275382702f, 0.00231305766f, 0.00188914326f,
+	0.00148682750f, 0.00110992580f, 0.000761378091f, 0.000443308527f,
+};
+
+static const float peak_60_q3_m12[64] = {
+	0.999020994f, -0.00195542281f, -0.00195024395f, -0.00194495835f, -0.00193956657f, -0.00193406921f,
+	-0.00192846695f, -0.00192276028f, -0.00191694987f, -0.00191103644f, -0.00190502068f, -0.00189890293f,
+	-0.00189268391f, -0.00188636442f, -0.00187994505f, -0.00187342649f, -0.00186680956f, -0.00186009461f,
+	-0.00185328245f, -0.00184637366f, -0.00183936907f, -0.00183226936f, -0.00182507513f, -0.00181778707f,
+	-0.00181040587f, -0.00180293224f, -0.00179536687f, -0.00178771059f, -0.00177996408f, -0.00177212805f,
+	-0.00176420319f, -0.00175619021f, -0.00174808980f, -0.00173990265f, -0.00173162960f, -0.00172327133f,
+	-0.00171482854f, -0.00170630217f, -0.00169769290f, -0.00168900145f, -0.00168022851f, -0.00167137478f,
+	-0.00166244106f, -0.00165342819f, -0.00164433697f, -0.00163516810f, -0.00162592228f, -0.00161660020f,
+	-0.00160720281f, -0.00159773091f, -0.00158818508f, -0.00157856615f, -0.00156887504f, -0.00155911245f,
+	-0.00154927908f, -0.00153937598f, -0.00152940385f, -0.00151936337f, -0.00150925550f, -0.00149908091f,
+	-0.00148884044f, -0.00147853501f, -0.00146816531f, -0.00145773217f,
+};
+
+static const float peak_10k_q07_p20[64] = {
+	4.67438936f, 1.12548161f, -4.00378609f, -1.43286824f, 0.295677006f, 0.353454113f,
+	0.0540169589f, -0.0483022518f, -0.0247056298f, 0.00129452546f, 0.00492923707f, 0.00127234159f,
+	-0.000514638610f, -0.000391071342f, -2.53666094e-05f, 6.39795835e-05f, 2.42512142e-05f, -4.31001990e-06f,
+	-5.76952516e-06f, -9.76475462e-07f, 7.59430520e-07f, 4.11769861e-07f, -1.32050859e-08f, -7.95917998e-08f,
+	-2.19565912e-08f, 7.87723220e-09f, 6.44118581e-09f, 5.27735133e-10f, -1.02011066e-09f, -4.09287410e-10f,
+	6.17922102e-11f, 9.40187858e-11f, 1.74614073e-11f, -1.19010322e-11f, -6.84896627e-12f, 8.56027082e-14f,
+	1.28279375e-12f, 3.77219875e-13f, -1.19808839e-13f, -1.05906142e-13f, -1.04583014e-14f, 1.62270760e-14f,
+	6.88919848e-15f, -8.66974697e-16f, -1.52951270e-15f, -3.09433418e-16f, 1.85837414e-16f, 1.13694268e-16f,
+	7.29639423e-19f, -2.06358865e-17f, -6.45472855e-18f, 1.80893461e-18f, 1.73832750e-18f, 2.00573824e-19f,
+	-2.57492639e-19f, -1.15670197e-19f, 1.18116424e-20f, 2.48398557e-20f, 5.44148568e-21f, -2.89059376e-21f,
+	-1.88374572e-21f, -4.66650795e-23f, 3.31315320e-22f, 1.10044922e-22f,
+};
+
+static const float od_x1_a010[128] = {
+	-2.03618442e-11f, 2.14494594e-05f, 6.39003047e-05f, 3.32816380e-05f, -7.63207790e-05f, -5.45683033e-05f,
+	0.000123590929f, 9.47113440e-05f, -0.000191778585f, -0.000159831514f, 0.000274291844f, 0.000242963826f,
+	-0.000385160529f, -0.000356684352f, 0.000523949042f, 0.000501794391f, -0.000703046215f, -0.000690664805f,
+	0.000928082503f, 0.000927835936f, -0.00122060301f, -0.00123159075f, 0.00160308508f, 0.00161626830f,
+	-0.00213035895f, -0.00211605127f, 0.00289825117f, 0.00277052494f, -0.00414417777f, -0.00363347819f,
+	0.00652656611f, 0.00452353200f, -0.0127721308f, 0.00123376481f, 0.0871437714f, 0.202287450f,
+	0.249022037f, 0.187945992f, 0.0807441548f, 0.00803902000f, -0.0144950449f, -0.0186278969f,
+	-0.0220541563f, -0.0188656524f, -0.00943272002f, -0.00492476532f, -0.00743933395f, -0.00867509842f,
+	-0.00621455256f, -0.00544032268f, -0.00760796573f, -0.00839482155f, -0.00680162199f, -0.00612359960f,
+	-0.00717280619f, -0.00753629114f, -0.00662559457f, -0.00621310296f, -0.00673359912f, -0.00691697281f,
+	-0.00644483790f, -0.00619578501f, -0.00639419770f, -0.00645554345f, -0.00622680038f, -0.00607587583f,
+	-0.00610258011f, -0.00609354908f, -0.00598784303f, -0.00588602107f, -0.00582191721f, -0.00577232987f,
+	-0.00572411995f, -0.00567241106f, -0.00561698154f, -0.00555931497f, -0.00550095737f, -0.00544291502f,
+	-0.00538564101f, -0.00532922801f, -0.00527360663f, -0.00521867350f, -0.00516434945f, -0.00511058932f,
+	-0.00505737448f, -0.00500470027f, -0.00495256577f, -0.00490097096f, -0.00484991260f, -0.00479938742f,
+	-0.00474938937f, -0.00469991285f, -0.00465095229f, -0.00460250163f, -0.00455455575f, -0.00450710952f,
+	-0.00446015736f, -0.00441369414f, -0.00436771475f, -0.00432221452f, -0.00427718833f, -0.00423263106f,
+	-0.00418853806f, -0.00414490420f, -0.00410172436f, -0.00405899482f, -0.00401671045f, -0.00397486705f,
+	-0.00393345905f, -0.00389248272f, -0.00385193340f, -0.00381180644f, -0.00377209717f, -0.00373280142f,
+	-0.00369391544f, -0.00365543459f, -0.00361735444f, -0.00357967103f, -0.00354238017f, -0.00350547768f,
+	-0.00346895983f, -0.00343282218f, -0.00339706102f, -0.00336167263f, -0.00332665257f, -0.00329199759f,
+	-0.00325770350f, -0.00322376657f,
+};
+
+static const float od_x1_a050[128] = {
+	-1.01809221e-10f, 0.000107247288f, 0.000319501502f, 0.000166408165f, -0.000381603895f, -0.000272841484f,
+	0.000617954764f, 0.000473556953f, -0.000958892633f, -0.000799157482f, 0.00137145934f, 0.00121481903f,
+	-0.00192580256f, -0.00178342161f, 0.00261974544f, 0.00250897184f, -0.00351523142f, -0.00345332362f,
+	0.00464041485f, 0.00463918271f, -0.00610301225f, -0.00615795096f, 0.00801542774f, 0.00808134489f,
+	-0.0106517905f, -0.0105802473f, 0.0144912684f, 0.0138526401f, -0.0207208693f, -0.0181673672f,
+	0.0326328538f, 0.0226176772f, -0.0638606548f, -0.0181633718f, 0.274677873f, 0.638011634f,
+	0.800388396f, 0.608835638f, 0.232106596f, -0.0136886239f, -0.0656675547f, -0.0675244331f,
+	-0.0873092487f, -0.0805817842f, -0.0416059196f, -0.0239405576f, -0.0384677127f, -0.0448725633f,
+	-0.0321087837f, -0.0277022328f, -0.0381721854f, -0.0419296473f, -0.0339177102f, -0.0305440947f,
+	-0.0358225442f, -0.0376662686f, -0.0331274495f, -0.0310702845f, -0.0336728692f, -0.0345879905f,
+	-0.0322255492f, -0.0309791453f, -0.0319707021f, -0.0322773308f, -0.0311336983f, -0.0303791873f,
+	-0.0305127911f, -0.0304676779f, -0.0299391616f, -0.0294300504f, -0.0291095264f, -0.0288615860f,
+	-0.0286205299f, -0.0283619855f, -0.0280848369f, -0.0277965087f, -0.0275047198f, -0.0272145085f,
+	-0.0269281399f, -0.0266460758f, -0.0263679698f, -0.0260933042f, -0.0258216858f, -0.0255528875f,
+	-0.0252868123f, -0.0250234380f, -0.0247627702f, -0.0245047975f, -0.0242495090f, -0.0239968821f,
+	-0.0237468928f, -0.0234995112f, -0.0232547037f, -0.0230124518f, -0.0227727238f, -0.0225354917f,
+	-0.0223007314f, -0.0220684148f, -0.0218385197f, -0.0216110200f, -0.0213858895f, -0.0211631060f,
+	-0.0209426414f, -0.0207244717f, -0.0205085762f, -0.0202949308f, -0.0200835094f, -0.0198742934f,
+	-0.0196672548f, -0.0194623731f, -0.0192596242f, -0.0190589894f, -0.0188604444f, -0.0186639689f,
+	-0.0184695367f, -0.0182771310f, -0.0180867314f, -0.0178983174f, -0.0177118648f, -0.0175273530f,
+	-0.0173447635f, -0.0171640757f, -0.0169852711f, -0.0168083310f, -0.0166332312f, -0.0164599568f,
+	-0.0162884854f, -0.0161188021f,
+};
+
+static const float od_x4_a050[128] = {
+	-9.38656849e-19f, 9.88804308e-13f, -7.47497376e-12f, 2.79988654e-11f, -6.57756141e-11f, 9.95825367e-11f,
+	-6.07376371e-11f, -1.89909727e-10f, 8.77187101e-10f, -2.30058839e-09f, 4.81393103e-09f, -9.06143161e-09f,
+	2.22401404e-08f, -1.61410298e-08f, -4.80945062e-08f, 1.00608382e-07f, -9.04492836e-08f, 9.50955368e-08f,
+	-1.53743926e-07f, 1.06123210e-07f, 1.13952730e-07f, -2.41169062e-07f, 1.34126182e-07f, -1.08330298e-07f,
+	0.000107552318f, 0.000319241546f, 0.000166242899f, -0.000381295453f, -0.000272755511f, 0.000617785961f,
+	0.000473186548f, -0.000958460150f, -0.000798802881f, 0.00137094990f, 0.00121434394f, -0.00192514760f,
+	-0.00178275420f, 0.00261883950f, 0.00250801863f, -0.00351394946f, -0.00345181930f, 0.00463845441f,
+	0.00463628257f, -0.00609965669f, -0.00614858791f, 0.00801461842f, 0.00808129366f, -0.0106675886f,
+	-0.0106036700f, 0.0145272110f, 0.0137820421f, -0.0206210166f, -0.0182874277f, 0.0327759348f,
+	0.0223802812f, -0.0629972368f, -0.0150115052f, 0.273691952f, 0.628063142f, 0.785537481f,
+	0.598907650f, 0.228589952f, -0.0140796602f, -0.0645446107f, -0.0665109754f, -0.0865197182f,
+	-0.0802722573f, -0.0415193886f, -0.0239744298f, -0.0385458916f, -0.0449346974f, -0.0321516208f,
+	-0.0277176537f, -0.0381668843f, -0.0419194736f, -0.0339125060f, -0.0305425785f, -0.0358209535f,
+	-0.0376650617f, -0.0331281535f, -0.0310715437f, -0.0336729214f, -0.0345874578f, -0.0322257131f,
+	-0.0309796929f, -0.0319704488f, -0.0322770663f, -0.0311336666f, -0.0303795226f, -0.0305127539f,
+	-0.0304673277f, -0.0299394280f, -0.0294299759f, -0.0291096866f, -0.0288613588f, -0.0286205709f,
+	-0.0283621512f, -0.0280846953f, -0.0277965888f, -0.0275046322f, -0.0272145998f, -0.0269281194f,
+	-0.0266460478f, -0.0263679884f, -0.0260933004f, -0.0258216895f, -0.0255528837f, -0.0252868123f,
+	-0.0250234418f, -0.0247627739f, -0.0245047994f, -0.0242495127f, -0.0239968859f, -0.0237468928f,
+	-0.0234995112f, -0.0232547075f, -0.0230124556f, -0.0227727294f, -0.0225354955f, -0.0223007314f,
+	-0.0220684167f, -0.0218385197f, -0.0216110181f, -0.0213858895f, -0.0211631060f, -0.0209426414f,
+	-0.0207244717f, -0.0205085762f,
+};
+
+#endif /* TEST_GOLDEN_H_ */
@@ -0,0 +1,172 @@
+/*
+ * test_peaking.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "IFX_PeakingFilter.h"
+#include "test_util.h"
+
+#include <math.h>
+
+#define FS 48000.0
+#define PI_D 3.14159265358979323846
+
+// Same bilinear peaking section as IFX_PeakingFilter_Calc, in double precision and normalised:
+// {b0, b1, b2, -a1, -a2}
+static void designRef(double *k, double fc, double Q, double gain) {
+
+	double wcT = 2.0 * tan(PI_D * fc / FS);
+	double wcT2 = wcT * wcT;
+	double norm = 1.0 / (4.0 + 2.0 * wcT / Q + wcT2);
+
+	k[0] = (4.0 + 2.0 * gain * wcT / Q + wcT2) * norm;
+	k[1] = (2.0 * wcT2 - 8.0) * norm;
+	k[2] = (4.0 - 2.0 * gain * wcT / Q + wcT2) * norm;
+	k[3] = -(2.0 * wcT2 - 8.0) * norm;
+	k[4] = -(4.0 - 2.0 * wcT / Q + wcT2) * norm;
+}
+
+// Amplitude of a sinusoid at f in y[0..n-1] starting at sample n0: least squares fit of
+// a sin + b cos, exact for any window length
+static double fitAmplitude(const double *y, uint32_t n0, uint32_t n, double f) {
+
+	double ss = 0.0, sc = 0.0, cc = 0.0, ys = 0.0, yc = 0.0;
+
+	for (uint32_t i = n0; i < n; i++) {
+		double s = sin(2.0 * PI_D * f * i / FS);
+		double c = cos(2.0 * PI_D * f * i / FS);
+		ss += s * s;
+		sc += s * c;
+		cc += c * c;
+		ys += y[i] * s;
+		yc += y[i] * c;
+	}
+
+	double det = ss * cc - sc * sc;
+	double a = (ys * cc - yc * sc) / det;
+	double b = (yc * ss - ys * sc) / det;
+
+	return sqrt(a * a + b * b);
+}
+
+// Largest pole radius of 1 - k3 z^-1 - k4 z^-2
+static double poleRadius(double k3, double k4) {
+
+	double disc = k3 * k3 + 4.0 * k4;
+
+	if (disc < 0.0) {
+		return sqrt(-k4);
+	}
+
+	double r1 = fabs(0.5 * (k3 + sqrt(disc)));
+	double r2 = fabs(0.5 * (k3 - sqrt(disc)));
+
+	return (r1 > r2) ? r1 : r2;
+}
+
+#define SINE_SAMPLES 48000
+#define SINE_SETTLE 24000
+
+// Drive the float filter and a double precision biquad with a sine at fc, compare the steady state
+// amplitudes with each other and with the design gain (the peak of the section is exactly at fc)
+static void testMagnitudeAtCenter(void) {
+
+	static const float fcs[] = { 30.0f, 100.0f, 1000.0f, 5000.0f, 15000.0f };
+	static const float Qs[] = { 0.5f, 1.0f, 3.0f };
+	static const float gainsDb[] = { -12.0f, -6.0f, 6.0f, 12.0f };
+
+	static double yFloat[SINE_SAMPLES];
+	static double yRef[SINE_SAMPLES];
+
+	double worstDb = 0.0;
+
+	for (uint32_t f = 0; f < sizeof(fcs) / sizeof(fcs[0]); f++) {
+		for (uint32_t q = 0; q < sizeof(Qs) / sizeof(Qs[0]); q++) {
+			for (uint32_t g = 0; g < sizeof(gainsDb) / sizeof(gainsDb[0]); g++) {
+
+				double gain = pow(10.0, gainsDb[g] / 20.0);
+
+				IFX_PeakingFilter filt;
+				IFX_PeakingFilter_Init(&filt, (float) FS);
+				IFX_PeakingFilter_SetParameters(&filt, fcs[f], Qs[q], (float) gain);
+
+				double k[5];
+				designRef(k, fcs[f], Qs[q], gain);
+				double s1 = 0.0, s2 = 0.0;
+
+				for (uint32_t i = 0; i < SINE_SAMPLES; i++) {
+					double x = 0.5 * sin(2.0 * PI_D * fcs[f] * i / FS);
+
+					yFloat[i] = IFX_PeakingFilter_Update(&filt, (float) x);
+
+					double y = k[0] * x + s1;
+					s1 = k[1] * x + k[3] * y + s2;
+					s2 = k[2] * x + k[4] * y;
+					yRef[i] = y;
+				}
+
+				double ampFloat = fitAmplitude(yFloat, SINE_SETTLE, SINE_SAMPLES, fcs[f]);
+				double ampRef = fitAmplitude(yRef, SINE_SETTLE, SINE_SAMPLES, fcs[f]);
+				double errDb = 20.0 * log10(ampFloat / ampRef);
+				double refErrDb = 20.0 * log10(ampRef / 0.5) - gainsDb[g];
+
+				TEST_CHECK(fabs(errDb) < 0.01, "fc %g Q %g gain %g dB: float vs double %.5f dB", fcs[f], Qs[q], gainsDb[g], errDb);
+				TEST_CHECK(fabs(refErrDb) < 0.001, "fc %g Q %g gain %g dB: reference off by %.5f dB", fcs[f], Qs[q], gainsDb[g], refErrDb);
+
+				if (fabs(errDb) > worstDb) {
+					worstDb = fabs(errDb);
+				}
+			}
+		}
+	}
+
+	printf("magnitude at fc: worst float vs double %.2e dB\n", worstDb);
+}
+
+// Every band the UI sliders can request must be stable: Q 0.05 to 3.15 in 0.05 steps, +/-20 dB,
+// 20 Hz to 20 kHz. Checked on the float coefficients of both the filter and the design helper used
+// by IFX_BiquadCascade.
+static void testPoleRadius(void) {
+
+	double worst = 0.0;
+
+	for (uint32_t qi = 0; qi <= 62; qi++) {
+		float Q = 0.05f + 0.05f * qi;
+
+		for (int32_t gDb = -20; gDb <= 20; gDb++) {
+			float gain = powf(10.0f, gDb / 20.0f);
+
+			for (uint32_t fi = 0; fi <= 60; fi++) {
+				float fc = 20.0f * powf(1000.0f, fi / 60.0f);
+
+				IFX_PeakingFilter filt;
+				IFX_PeakingFilter_Init(&filt, (float) FS);
+				IFX_PeakingFilter_SetParameters(&filt, fc, Q, gain);
+
+				float coef[5];
+				IFX_PeakingFilter_Design(coef, filt.sampleTime_s, fc, Q, gain);
+
+				double r = poleRadius(filt.k[3], filt.k[4]);
+				double rDesign = poleRadius(coef[3], coef[4]);
+
+				TEST_CHECK(r < 1.0, "fc %g Q %g gain %d dB: pole radius %.9f", fc, Q, (int) gDb, r);
+				TEST_CHECK(rDesign < 1.0, "fc %g Q %g gain %d dB: design pole radius %.9f", fc, Q, (int) gDb, rDesign);
+
+				if (r > worst) {
+					worst = r;
+				}
+			}
+		}
+	}
+
+	printf("pole radius: worst %.9f\n", worst);
+}
+
+int main(void) {
+
+	testMagnitudeAtCenter();
+	testPoleRadius();
+
+	return TEST_RESULT();
+}
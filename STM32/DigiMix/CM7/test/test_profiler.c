@@ -0,0 +1,227 @@
+/*
+ * test_profiler.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// IFX_Profiler fed with given block times through IFX_Profiler_AddBlock and DMA events through
+// IFX_Profiler_DmaEvent, the order processData and the half-transfer callbacks produce them in:
+// min/avg/max, histogram bin edges, xrun counting and resynchronisation, and the control side
+// reset (resetRequest, SetBudget).
+
+#include "IFX_Profiler.h"
+#include "test_util.h"
+
+#define BUDGET 1000
+
+static uint32_t histTotal(const IFX_Profiler *prof) {
+
+	uint32_t total = 0;
+	for (uint32_t n = 0; n < IFX_PROFILER_HIST_BINS; n++) {
+		total += prof->hist[n];
+	}
+	return total;
+}
+
+// One block handed over by its interrupt and finished in time
+static void normalBlock(IFX_Profiler *prof, uint32_t elapsed) {
+	IFX_Profiler_DmaEvent(prof);
+	IFX_Profiler_AddBlock(prof, elapsed);
+}
+
+static void testStats(void) {
+
+	IFX_Profiler prof;
+	IFX_Profiler_Init(&prof, BUDGET);
+
+	TEST_CHECK(IFX_Profiler_Average(&prof.block) == 0, "average of an empty stat: %u", (unsigned) IFX_Profiler_Average(&prof.block));
+	TEST_CHECK(prof.block.count == 0 && prof.block.max == 0 && prof.block.min == 0xFFFFFFFFu, "empty stat after Init");
+
+	static const uint32_t times[] = { 300, 120, 700, 450, 130 };
+	for (uint32_t n = 0; n < sizeof(times) / sizeof(times[0]); n++) {
+		normalBlock(&prof, times[n]);
+	}
+
+	TEST_CHECK(prof.block.min == 120, "min %u, expected 120", (unsigned) prof.block.min);
+	TEST_CHECK(prof.block.max == 700, "max %u, expected 700", (unsigned) prof.block.max);
+	TEST_CHECK(prof.block.count == 5, "count %u, expected 5", (unsigned) prof.block.count);
+	TEST_CHECK(prof.block.total == 1700, "total %llu, expected 1700", (unsigned long long) prof.block.total);
+	TEST_CHECK(IFX_Profiler_Average(&prof.block) == 340, "average %u, expected 340", (unsigned) IFX_Profiler_Average(&prof.block));
+	TEST_CHECK(prof.xruns == 0, "xruns %u on blocks that all finished in time", (unsigned) prof.xruns);
+
+	// Average truncates
+	IFX_ProfilerStat stat = { .min = 1, .max = 2, .total = 5, .count = 3 };
+	TEST_CHECK(IFX_Profiler_Average(&stat) == 1, "average 5/3: %u", (unsigned) IFX_Profiler_Average(&stat));
+
+	// Stages: each StageEnd records into its own stat, the block stat is separate
+	uint32_t a = IFX_Profiler_AddStage(&prof, "a");
+	uint32_t b = IFX_Profiler_AddStage(&prof, "b");
+	TEST_CHECK(a == 0 && b == 1 && prof.numStages == 2, "stage indices %u %u, numStages %u", (unsigned) a, (unsigned) b, (unsigned) prof.numStages);
+
+	for (uint32_t n = 0; n < 4; n++) {
+		IFX_Profiler_DmaEvent(&prof);
+		IFX_Profiler_BlockBegin(&prof);
+		IFX_Profiler_StageEnd(&prof, a);
+		IFX_Profiler_StageEnd(&prof, b);
+		IFX_Profiler_BlockEnd(&prof);
+	}
+	for (uint32_t s = 0; s < 2; s++) {
+		const IFX_ProfilerStat *st = &prof.stage[s];
+		uint32_t avg = IFX_Profiler_Average(st);
+		TEST_CHECK(st->count == 4, "stage %u count %u, expected 4", (unsigned) s, (unsigned) st->count);
+		TEST_CHECK(st->min <= avg && avg <= st->max, "stage %u min %u avg %u max %u", (unsigned) s, (unsigned) st->min, (unsigned) avg, (unsigned) st->max);
+	}
+	TEST_CHECK(prof.stage[2].count == 0, "unused stage recorded %u", (unsigned) prof.stage[2].count);
+	TEST_CHECK(prof.block.count == 9, "block count %u, expected 9", (unsigned) prof.block.count);
+
+	// Once all stages are taken the last one is handed out again
+	for (uint32_t n = 2; n < IFX_PROFILER_MAX_STAGES; n++) {
+		IFX_Profiler_AddStage(&prof, "x");
+	}
+	uint32_t extra = IFX_Profiler_AddStage(&prof, "extra");
+	TEST_CHECK(extra == IFX_PROFILER_MAX_STAGES - 1 && prof.numStages == IFX_PROFILER_MAX_STAGES,
+			"stage past the limit: index %u, numStages %u", (unsigned) extra, (unsigned) prof.numStages);
+}
+
+static void testHistogram(void) {
+
+	IFX_Profiler prof;
+	IFX_Profiler_Init(&prof, BUDGET);
+
+	// Bin n holds [n, n + 1) tenths of the budget; the budget itself and anything above go to the last bin
+	static const struct {
+		uint32_t elapsed;
+		uint32_t bin;
+	} cases[] = {
+		{ 0, 0 }, { 99, 0 }, { 100, 1 }, { 101, 1 }, { 199, 1 }, { 500, 5 }, { 899, 8 }, { 900, 9 },
+		{ 999, 9 }, { BUDGET, IFX_PROFILER_HIST_BINS - 1 }, { BUDGET + 1, IFX_PROFILER_HIST_BINS - 1 },
+		{ 0xFFFFFFFFu, IFX_PROFILER_HIST_BINS - 1 },
+	};
+
+	for (uint32_t n = 0; n < sizeof(cases) / sizeof(cases[0]); n++) {
+		uint32_t before = prof.hist[cases[n].bin];
+		normalBlock(&prof, cases[n].elapsed);
+		TEST_CHECK(prof.hist[cases[n].bin] == before + 1, "elapsed %u not counted in bin %u", (unsigned) cases[n].elapsed, (unsigned) cases[n].bin);
+		TEST_CHECK(histTotal(&prof) == n + 1, "elapsed %u counted %u times", (unsigned) cases[n].elapsed, (unsigned) (histTotal(&prof) - n));
+	}
+
+	// A zero budget is taken as 1: every block but a 0 one lands in the last bin
+	IFX_Profiler_Init(&prof, 0);
+	TEST_CHECK(prof.budget == 1, "budget 0 stored as %u", (unsigned) prof.budget);
+	normalBlock(&prof, 0);
+	normalBlock(&prof, 1);
+	TEST_CHECK(prof.hist[0] == 1 && prof.hist[IFX_PROFILER_HIST_BINS - 1] == 1, "zero budget bins %u %u",
+			(unsigned) prof.hist[0], (unsigned) prof.hist[IFX_PROFILER_HIST_BINS - 1]);
+}
+
+static void testXruns(void) {
+
+	IFX_Profiler prof;
+	IFX_Profiler_Init(&prof, BUDGET);
+
+	for (uint32_t n = 0; n < 10; n++) {
+		normalBlock(&prof, 500);
+	}
+	TEST_CHECK(prof.xruns == 0, "xruns %u, expected 0", (unsigned) prof.xruns);
+
+	// The next interrupt fires while the block is still running: one xrun, then the pending block
+	// runs and the count is back in step
+	IFX_Profiler_DmaEvent(&prof);
+	IFX_Profiler_DmaEvent(&prof);
+	IFX_Profiler_AddBlock(&prof, 1200);
+	TEST_CHECK(prof.xruns == 1, "late block: xruns %u, expected 1", (unsigned) prof.xruns);
+	IFX_Profiler_AddBlock(&prof, 300);
+	TEST_CHECK(prof.xruns == 1, "pending block counted as an xrun: xruns %u", (unsigned) prof.xruns);
+	normalBlock(&prof, 500);
+	TEST_CHECK(prof.xruns == 1, "back in step: xruns %u, expected 1", (unsigned) prof.xruns);
+
+	// Three interrupts during one block, two of them merged by the task notification: one xrun,
+	// only the last block is still pending, the merged one is not counted again
+	IFX_Profiler_DmaEvent(&prof);
+	IFX_Profiler_DmaEvent(&prof);
+	IFX_Profiler_DmaEvent(&prof);
+	IFX_Profiler_AddBlock(&prof, 2500);
+	TEST_CHECK(prof.xruns == 2, "merged interrupts: xruns %u, expected 2", (unsigned) prof.xruns);
+	IFX_Profiler_AddBlock(&prof, 300);
+	normalBlock(&prof, 500);
+	normalBlock(&prof, 500);
+	TEST_CHECK(prof.xruns == 2, "after merged interrupts: xruns %u, expected 2", (unsigned) prof.xruns);
+
+	// More blocks than interrupts (catch-up run): resynchronised without an xrun
+	IFX_Profiler_AddBlock(&prof, 100);
+	IFX_Profiler_AddBlock(&prof, 100);
+	TEST_CHECK(prof.xruns == 2 && prof.blocksDone == prof.dmaEvents, "catch-up: xruns %u, blocks %u, events %u",
+			(unsigned) prof.xruns, (unsigned) prof.blocksDone, (unsigned) prof.dmaEvents);
+	normalBlock(&prof, 500);
+	IFX_Profiler_DmaEvent(&prof);
+	IFX_Profiler_DmaEvent(&prof);
+	IFX_Profiler_AddBlock(&prof, 1100);
+	TEST_CHECK(prof.xruns == 3, "late block after catch-up: xruns %u, expected 3", (unsigned) prof.xruns);
+	IFX_Profiler_AddBlock(&prof, 300);
+
+	// Counters wrapping
+	prof.dmaEvents = 0xFFFFFFFEu;
+	prof.blocksDone = 0xFFFFFFFEu;
+	for (uint32_t n = 0; n < 4; n++) {
+		normalBlock(&prof, 500);
+	}
+	TEST_CHECK(prof.xruns == 3, "across the counter wrap: xruns %u, expected 3", (unsigned) prof.xruns);
+	IFX_Profiler_DmaEvent(&prof);
+	IFX_Profiler_DmaEvent(&prof);
+	IFX_Profiler_AddBlock(&prof, 1100);
+	TEST_CHECK(prof.xruns == 4, "late block after the wrap: xruns %u, expected 4", (unsigned) prof.xruns);
+}
+
+static void testReset(void) {
+
+	IFX_Profiler prof;
+	IFX_Profiler_Init(&prof, BUDGET);
+	uint32_t stage = IFX_Profiler_AddStage(&prof, "eq");
+
+	IFX_Profiler_DmaEvent(&prof);
+	IFX_Profiler_DmaEvent(&prof);
+	IFX_Profiler_AddBlock(&prof, 2000);
+	IFX_Profiler_AddBlock(&prof, 100);
+	TEST_CHECK(prof.xruns == 1 && prof.block.count == 2, "setup: xruns %u, count %u", (unsigned) prof.xruns, (unsigned) prof.block.count);
+
+	// resetRequest from the control side: nothing changes until the next BlockBegin
+	prof.resetRequest = 1;
+	normalBlock(&prof, 400);
+	TEST_CHECK(prof.block.count == 3 && prof.xruns == 1, "cleared before BlockBegin: count %u, xruns %u", (unsigned) prof.block.count, (unsigned) prof.xruns);
+
+	IFX_Profiler_DmaEvent(&prof);
+	IFX_Profiler_BlockBegin(&prof);
+	TEST_CHECK(prof.resetRequest == 0, "resetRequest not cleared");
+	TEST_CHECK(prof.block.count == 0 && prof.block.max == 0 && prof.block.min == 0xFFFFFFFFu && prof.xruns == 0 && histTotal(&prof) == 0,
+			"not cleared by BlockBegin: count %u, xruns %u, hist %u", (unsigned) prof.block.count, (unsigned) prof.xruns, (unsigned) histTotal(&prof));
+	TEST_CHECK(prof.numStages == 1 && prof.budget == BUDGET, "reset dropped the setup: stages %u, budget %u", (unsigned) prof.numStages, (unsigned) prof.budget);
+	IFX_Profiler_StageEnd(&prof, stage);
+	IFX_Profiler_BlockEnd(&prof);
+	TEST_CHECK(prof.block.count == 1 && prof.stage[stage].count == 1 && prof.xruns == 0,
+			"first block after the reset: count %u, stage %u, xruns %u", (unsigned) prof.block.count, (unsigned) prof.stage[stage].count, (unsigned) prof.xruns);
+
+	// SetBudget: new bin width right away, statistics restart at the next block
+	IFX_Profiler_SetBudget(&prof, 2 * BUDGET);
+	TEST_CHECK(prof.budget == 2 * BUDGET && prof.resetRequest == 1, "SetBudget: budget %u, resetRequest %u", (unsigned) prof.budget, (unsigned) prof.resetRequest);
+	IFX_Profiler_DmaEvent(&prof);
+	IFX_Profiler_BlockBegin(&prof);
+	TEST_CHECK(prof.block.count == 0 && histTotal(&prof) == 0, "SetBudget did not clear: count %u", (unsigned) prof.block.count);
+	IFX_Profiler_AddBlock(&prof, BUDGET);
+	TEST_CHECK(prof.hist[(IFX_PROFILER_HIST_BINS - 1) / 2] == 1, "old budget in the new histogram");
+	normalBlock(&prof, 2 * BUDGET - 1);
+	TEST_CHECK(prof.hist[IFX_PROFILER_HIST_BINS - 2] == 1, "just under the new budget not in bin %u", (unsigned) (IFX_PROFILER_HIST_BINS - 2));
+	TEST_CHECK(prof.xruns == 0, "xruns %u after SetBudget", (unsigned) prof.xruns);
+
+	IFX_Profiler_SetBudget(&prof, 0);
+	TEST_CHECK(prof.budget == 1, "SetBudget(0) stored %u", (unsigned) prof.budget);
+}
+
+int main(void) {
+
+	testStats();
+	testHistogram();
+	testXruns();
+	testReset();
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,365 @@
+/*
+ * test_uart_frame.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// UART_Frame on the byte streams the control UART sees: the same mixed stream of lines and packets
+// fed whole, byte by byte and in odd chunks gives the same frames; lines and packets at and past
+// their limits; Discard and Reset in the middle of a frame; back-to-back delimiters; and how fast
+// the framing comes back after a lost closing 0x00.
+
+#include "UART_Frame.h"
+#include "test_util.h"
+
+#include <string.h>
+
+#define MAX_FRAMES 32
+#define STREAM_MAX 2048
+
+typedef struct {
+	uint8_t binary;
+	uint32_t len;
+	uint8_t data[UART_FRAME_PACKET_MAX + 1];
+} Frame;
+
+// What the handlers received since the last clearFrames()
+static Frame frames[MAX_FRAMES];
+static uint32_t numFrames;
+
+typedef struct {
+	uint8_t binary;
+	const char *data;
+} Expect;
+
+typedef struct {
+	uint8_t data[STREAM_MAX];
+	uint32_t len;
+} Stream;
+
+static void record(uint8_t binary, const uint8_t *data, uint32_t len) {
+
+	if (numFrames < MAX_FRAMES && len <= UART_FRAME_PACKET_MAX) {
+		Frame *f = &frames[numFrames];
+		f->binary = binary;
+		f->len = len;
+		memcpy(f->data, data, len);
+	}
+	numFrames++;
+}
+
+static void onLine(const char *text, uint32_t len) {
+	TEST_CHECK(text[len] == '\0' && strlen(text) == len, "line of length %u not terminated at its end", (unsigned) len);
+	record(0, (const uint8_t *) text, len);
+}
+
+static void onPacket(const uint8_t *data, uint32_t len) {
+	record(1, data, len);
+}
+
+static void clearFrames(void) {
+	numFrames = 0;
+}
+
+static void addBytes(Stream *s, const void *data, uint32_t n) {
+	memcpy(&s->data[s->len], data, n);
+	s->len += n;
+}
+
+static void addText(Stream *s, const char *text) {
+	addBytes(s, text, (uint32_t) strlen(text));
+}
+
+static void addByte(Stream *s, uint8_t c) {
+	s->data[s->len++] = c;
+}
+
+// 0x00, the (zero free) packet body, 0x00
+static void addPacket(Stream *s, const char *body) {
+	addByte(s, 0x00);
+	addText(s, body);
+	addByte(s, 0x00);
+}
+
+// chunk 0 feeds the stream in one call
+static void feedChunked(UART_Frame *fr, const Stream *s, uint32_t chunk) {
+
+	if (chunk == 0) {
+		chunk = s->len;
+	}
+	for (uint32_t pos = 0; pos < s->len; pos += chunk) {
+		uint32_t n = (s->len - pos < chunk) ? s->len - pos : chunk;
+		UART_Frame_Feed(fr, &s->data[pos], n);
+	}
+}
+
+static void checkFrames(const char *name, const Expect *expected, uint32_t n) {
+
+	TEST_CHECK(numFrames == n, "%s: %u frames, expected %u", name, (unsigned) numFrames, (unsigned) n);
+
+	for (uint32_t i = 0; i < n && i < numFrames && i < MAX_FRAMES; i++) {
+		uint32_t len = (uint32_t) strlen(expected[i].data);
+		const Frame *f = &frames[i];
+
+		TEST_CHECK(f->binary == expected[i].binary && f->len == len && memcmp(f->data, expected[i].data, len) == 0,
+				"%s: frame %u is %s \"%.*s\", expected %s \"%s\"", name, (unsigned) i,
+				f->binary ? "packet" : "line", (int) f->len, (const char *) f->data,
+				expected[i].binary ? "packet" : "line", expected[i].data);
+	}
+}
+
+// Lines, packets (one with a '\n' in it), blank and padded lines and repeated delimiters in one
+// stream, split every possible way into equal chunks
+static void testChunking(void) {
+
+	static Stream s;
+	s.len = 0;
+	addText(&s, "v,1,50\r\n");
+	addPacket(&s, "\x05\x01\x02\x03\x04");
+	addText(&s, "\r\n\n");
+	addText(&s, "f,0,2,1000,3.5,0.7   \r\n");
+	addPacket(&s, "ab\ncd");
+	addByte(&s, 0x00);
+	addByte(&s, 0x00);
+	addText(&s, "pk");
+	addByte(&s, 0x00);
+	addText(&s, "m,3,1\n");
+
+	static const Expect expected[] = {
+		{ 0, "v,1,50" },
+		{ 1, "\x05\x01\x02\x03\x04" },
+		{ 0, "f,0,2,1000,3.5,0.7" },
+		{ 1, "ab\ncd" },
+		{ 1, "pk" },
+		{ 0, "m,3,1" },
+	};
+
+	for (uint32_t chunk = 0; chunk <= s.len; chunk++) {
+		UART_Frame fr;
+		UART_Frame_Init(&fr, onLine, onPacket);
+		clearFrames();
+
+		feedChunked(&fr, &s, chunk);
+
+		char name[32];
+		snprintf(name, sizeof(name), "chunks of %u", (unsigned) chunk);
+		checkFrames(name, expected, sizeof(expected) / sizeof(expected[0]));
+		TEST_CHECK(fr.overflows == 0, "%s: %u overflows", name, (unsigned) fr.overflows);
+	}
+}
+
+// A frame at its limit comes through, one byte more is dropped up to its terminator and counted,
+// and the next frame is unaffected
+static void testOverlong(void) {
+
+	static Stream s;
+	static char line[UART_FRAME_MAX + 2], packet[UART_FRAME_PACKET_MAX + 2];
+
+	UART_Frame fr;
+	UART_Frame_Init(&fr, onLine, onPacket);
+
+	for (uint32_t extra = 0; extra <= 1; extra++) {
+		memset(line, 'x', sizeof(line));
+		line[UART_FRAME_MAX + extra] = '\0';
+		memset(packet, 'p', sizeof(packet));
+		packet[UART_FRAME_PACKET_MAX + extra] = '\0';
+
+		s.len = 0;
+		addText(&s, line);
+		addText(&s, "\n");
+		addText(&s, "v,2,10\n");
+		addPacket(&s, packet);
+		addPacket(&s, "ok");
+		addText(&s, line);
+		addPacket(&s, "after line");
+
+		for (uint32_t chunk = 0; chunk <= 1; chunk++) {
+			UART_Frame_Init(&fr, onLine, onPacket);
+			clearFrames();
+			feedChunked(&fr, &s, chunk);
+
+			if (extra == 0) {
+				const Expect expected[] = { { 0, line }, { 0, "v,2,10" }, { 1, packet }, { 1, "ok" }, { 1, "after line" } };
+				checkFrames("at the limit", expected, sizeof(expected) / sizeof(expected[0]));
+				TEST_CHECK(fr.overflows == 0, "at the limit: %u overflows", (unsigned) fr.overflows);
+			} else {
+				// The unterminated long line at the end is cut short by the 0x00 that opens the packet
+				static const Expect expected[] = { { 0, "v,2,10" }, { 1, "ok" }, { 1, "after line" } };
+				checkFrames("one past the limit", expected, sizeof(expected) / sizeof(expected[0]));
+				TEST_CHECK(fr.overflows == 3, "one past the limit: %u overflows, expected 3", (unsigned) fr.overflows);
+			}
+		}
+	}
+}
+
+static void feedText(UART_Frame *fr, const char *text) {
+	UART_Frame_Feed(fr, (const uint8_t *) text, (uint32_t) strlen(text));
+}
+
+static void feedByte(UART_Frame *fr, uint8_t c) {
+	UART_Frame_Feed(fr, &c, 1);
+}
+
+static void testDiscardReset(void) {
+
+	UART_Frame fr;
+	UART_Frame_Init(&fr, onLine, onPacket);
+
+	// Discard in a line: the rest of it up to '\n' goes, the next line is whole
+	clearFrames();
+	feedText(&fr, "v,1,");
+	UART_Frame_Discard(&fr);
+	feedText(&fr, "50\nm,1,1\n");
+	static const Expect afterLine[] = { { 0, "m,1,1" } };
+	checkFrames("Discard in a line", afterLine, 1);
+
+	// Discard in a packet: dropped up to its closing 0x00, which does not open a new packet
+	clearFrames();
+	feedByte(&fr, 0x00);
+	feedText(&fr, "abc");
+	UART_Frame_Discard(&fr);
+	feedText(&fr, "de\nf");
+	feedByte(&fr, 0x00);
+	feedText(&fr, "v,3,3\n");
+	feedByte(&fr, 0x00);
+	feedText(&fr, "xyz");
+	feedByte(&fr, 0x00);
+	static const Expect afterPacket[] = { { 0, "v,3,3" }, { 1, "xyz" } };
+	checkFrames("Discard in a packet", afterPacket, 2);
+
+	// Discard between frames (error on the first byte of the next one): that frame goes
+	clearFrames();
+	UART_Frame_Discard(&fr);
+	feedText(&fr, "v,4,4\nm,0,0\n");
+	static const Expect afterIdle[] = { { 0, "m,0,0" } };
+	checkFrames("Discard between frames", afterIdle, 1);
+
+	// A 0x00 after a Discarded line still opens a packet
+	clearFrames();
+	feedText(&fr, "v,5");
+	UART_Frame_Discard(&fr);
+	feedByte(&fr, 0x00);
+	feedText(&fr, "q");
+	feedByte(&fr, 0x00);
+	static const Expect discardThenPacket[] = { { 1, "q" } };
+	checkFrames("Discard, then a packet", discardThenPacket, 1);
+
+	// Reset: the partial frame is forgotten and the next byte starts a new one, no terminator needed
+	clearFrames();
+	feedText(&fr, "v,1,");
+	UART_Frame_Reset(&fr);
+	feedText(&fr, "m,1,1\n");
+	feedByte(&fr, 0x00);
+	feedText(&fr, "abc");
+	UART_Frame_Reset(&fr);
+	feedText(&fr, "v,2,2\n");
+	UART_Frame_Discard(&fr);
+	UART_Frame_Reset(&fr);
+	feedText(&fr, "p\n");
+	static const Expect afterReset[] = { { 0, "m,1,1" }, { 0, "v,2,2" }, { 0, "p" } };
+	checkFrames("Reset", afterReset, 3);
+	TEST_CHECK(fr.overflows == 0, "Reset: %u overflows", (unsigned) fr.overflows);
+
+	// No handlers: frames are parsed and dropped
+	UART_Frame_Init(&fr, NULL, NULL);
+	clearFrames();
+	feedText(&fr, "v,1,1\n");
+	feedByte(&fr, 0x00);
+	feedText(&fr, "abc");
+	feedByte(&fr, 0x00);
+	checkFrames("no handlers", NULL, 0);
+}
+
+// The ESP32 sends 00 frame 00 per packet, so two packets in a row have two delimiters between them;
+// runs of delimiters (idle filler, a resend) never make an empty packet
+static void testDelimiters(void) {
+
+	static Stream s;
+	s.len = 0;
+	addPacket(&s, "one");
+	addPacket(&s, "two");
+	for (uint32_t n = 0; n < 5; n++) {
+		addByte(&s, 0x00);
+	}
+	addText(&s, "three");
+	addByte(&s, 0x00);
+	addText(&s, "v,1,1\n");
+
+	static const Expect expected[] = { { 1, "one" }, { 1, "two" }, { 1, "three" }, { 0, "v,1,1" } };
+
+	for (uint32_t chunk = 0; chunk <= 2; chunk++) {
+		UART_Frame fr;
+		UART_Frame_Init(&fr, onLine, onPacket);
+		clearFrames();
+		feedChunked(&fr, &s, chunk);
+		checkFrames("back-to-back delimiters", expected, sizeof(expected) / sizeof(expected[0]));
+	}
+}
+
+// Lines between packets, and a packet whose closing 0x00 was lost
+static void testInterleave(void) {
+
+	static Stream s;
+	s.len = 0;
+	addText(&s, "v,0,10\n");
+	addPacket(&s, "A1");
+	addText(&s, "m,0,1\n");
+	addPacket(&s, "B2");
+	addPacket(&s, "C3");
+	addText(&s, "l\n");
+
+	static const Expect expected[] = { { 0, "v,0,10" }, { 1, "A1" }, { 0, "m,0,1" }, { 1, "B2" }, { 1, "C3" }, { 0, "l" } };
+
+	for (uint32_t chunk = 0; chunk <= 3; chunk++) {
+		UART_Frame fr;
+		UART_Frame_Init(&fr, onLine, onPacket);
+		clearFrames();
+		feedChunked(&fr, &s, chunk);
+		checkFrames("interleaved", expected, sizeof(expected) / sizeof(expected[0]));
+	}
+
+	// Lost closing 0x00, next frame a packet: its opening 0x00 closes the cut one, which is handed
+	// out whole; the next packet's body is then read as a line and dropped by its closing 0x00, and
+	// the framing is back from the one after
+	s.len = 0;
+	addByte(&s, 0x00);
+	addText(&s, "lost");
+	addPacket(&s, "P1");
+	addPacket(&s, "P2");
+	addText(&s, "v,1,1\n");
+
+	UART_Frame fr;
+	UART_Frame_Init(&fr, onLine, onPacket);
+	clearFrames();
+	feedChunked(&fr, &s, 1);
+	static const Expect lostBeforePacket[] = { { 1, "lost" }, { 1, "P2" }, { 0, "v,1,1" } };
+	checkFrames("lost 0x00 before a packet", lostBeforePacket, 3);
+
+	// Lost closing 0x00, next frame a line: the line ends up in the packet (the decoder's CRC drops
+	// it), the next packet's body is lost as above, then everything is back
+	s.len = 0;
+	addByte(&s, 0x00);
+	addText(&s, "lost");
+	addText(&s, "m,2,0\n");
+	addPacket(&s, "P1");
+	addPacket(&s, "P2");
+	addText(&s, "v,2,2\n");
+
+	UART_Frame_Init(&fr, onLine, onPacket);
+	clearFrames();
+	feedChunked(&fr, &s, 0);
+	static const Expect lostBeforeLine[] = { { 1, "lostm,2,0\n" }, { 1, "P2" }, { 0, "v,2,2" } };
+	checkFrames("lost 0x00 before a line", lostBeforeLine, 3);
+	TEST_CHECK(fr.overflows == 0, "lost 0x00: %u overflows", (unsigned) fr.overflows);
+}
+
+int main(void) {
+
+	testChunking();
+	testOverlong();
+	testDiscardReset();
+	testDelimiters();
+	testInterleave();
+
+	return TEST_RESULT();
+}
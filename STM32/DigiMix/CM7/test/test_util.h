@@ -0,0 +1,28 @@
+/*
+ * test_util.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef TEST_UTIL_H_
+#define TEST_UTIL_H_
+
+#include <stdio.h>
+
+// Minimal checks for the host tests: a failed check prints its location and message and the test
+// keeps going, so one run reports every failure. main() returns TEST_RESULT() to ctest.
+
+static int testFailures = 0;
+
+#define TEST_CHECK(cond, ...) do { \
+	if (!(cond)) { \
+		printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+		printf(__VA_ARGS__); \
+		printf("\n"); \
+		testFailures++; \
+	} \
+} while (0)
+
+#define TEST_RESULT() (testFailures ? (printf("%d check(s) failed\n", testFailures), 1) : (printf("OK\n"), 0))
+
+#endif /* TEST_UTIL_H_ */